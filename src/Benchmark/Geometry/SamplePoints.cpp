@@ -54,4 +54,7 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({1000000});
@@ -25,10 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/BoundingVolume.h"
-#include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Helper.h"
 
 #include <numeric>
 
@@ -37,6 +38,63 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Number of points reduced by one task in the chunked reductions below.
+constexpr int kReductionChunkSize = 4096;
+
+/// Returns the indices of the points for which \p inside returns true, in
+/// increasing order.
+template <typename Predicate>
+std::vector<size_t> SelectPoints(const std::vector<Eigen::Vector3d>& points,
+                                 const Predicate& inside) {
+    std::vector<char> mask(points.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points.size(); i++) {
+        mask[i] = inside(points[i]);
+    }
+    return utility::NonZeroIndices(mask);
+}
+
+/// Computes the componentwise minimum and maximum of \p points, which must
+/// not be empty, after applying \p transform to each of them.
+template <typename Transform>
+std::tuple<Eigen::Vector3d, Eigen::Vector3d> ComputeBounds(
+        const std::vector<Eigen::Vector3d>& points,
+        const Transform& transform) {
+    int num_chunks =
+            ((int)points.size() + kReductionChunkSize - 1) /
+            kReductionChunkSize;
+    std::vector<Eigen::Vector3d> chunk_min(num_chunks), chunk_max(num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t begin = (size_t)c * kReductionChunkSize;
+        size_t end = std::min(points.size(), begin + kReductionChunkSize);
+        Eigen::Vector3d min_bound = transform(points[begin]);
+        Eigen::Vector3d max_bound = min_bound;
+        for (size_t i = begin + 1; i < end; i++) {
+            Eigen::Vector3d p = transform(points[i]);
+            min_bound = min_bound.cwiseMin(p);
+            max_bound = max_bound.cwiseMax(p);
+        }
+        chunk_min[c] = min_bound;
+        chunk_max[c] = max_bound;
+    }
+    Eigen::Vector3d min_bound = chunk_min[0];
+    Eigen::Vector3d max_bound = chunk_max[0];
+    for (int c = 1; c < num_chunks; c++) {
+        min_bound = min_bound.cwiseMin(chunk_min[c]);
+        max_bound = max_bound.cwiseMax(chunk_max[c]);
+    }
+    return std::make_tuple(min_bound, max_bound);
+}
+
+}  // unnamed namespace
+
 OrientedBoundingBox& OrientedBoundingBox::Clear() {
     center_.setZero();
     extent_.setZero();
@@ -129,32 +187,14 @@ std::vector<Eigen::Vector3d> OrientedBoundingBox::GetBoxPoints() const {
 
 std::vector<size_t> OrientedBoundingBox::GetPointIndicesWithinBoundingBox(
         const std::vector<Eigen::Vector3d>& points) const {
-    auto box_points = GetBoxPoints();
-    auto TestPlane = [](const Eigen::Vector3d& a, const Eigen::Vector3d& b,
-                        const Eigen::Vector3d c, const Eigen::Vector3d& x) {
-        Eigen::Matrix3d design;
-        design << (b - a), (c - a), (x - a);
-        return design.determinant();
-    };
-    std::vector<size_t> indices;
-    for (size_t idx = 0; idx < points.size(); idx++) {
-        const auto& point = points[idx];
-        if (TestPlane(box_points[0], box_points[1], box_points[3], point) <=
-                    0 &&
-            TestPlane(box_points[0], box_points[5], box_points[3], point) >=
-                    0 &&
-            TestPlane(box_points[2], box_points[5], box_points[7], point) <=
-                    0 &&
-            TestPlane(box_points[1], box_points[4], box_points[7], point) >=
-                    0 &&
-            TestPlane(box_points[3], box_points[4], box_points[5], point) <=
-                    0 &&
-            TestPlane(box_points[0], box_points[1], box_points[7], point) >=
-                    0) {
-            indices.push_back(idx);
-        }
-    }
-    return indices;
+    // Test in the frame of the box, where it is an axis aligned box centered
+    // at the origin.
+    const Eigen::Matrix3d R_inv = R_.transpose();
+    const Eigen::Vector3d half_extent = extent_ / 2;
+    return SelectPoints(points, [&](const Eigen::Vector3d& point) {
+        Eigen::Vector3d local = R_inv * (point - center_);
+        return (local.cwiseAbs().array() <= half_extent.array()).all();
+    });
 }
 
 OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
@@ -167,13 +207,20 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
 }
 
 OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
-        const std::vector<Eigen::Vector3d>& points) {
-    PointCloud hull_pcd;
-    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+        const std::vector<Eigen::Vector3d>& points, bool use_convex_hull) {
+    if (points.empty()) {
+        return OrientedBoundingBox();
+    }
+    std::vector<Eigen::Vector3d> hull_points;
+    if (use_convex_hull) {
+        hull_points = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+    }
+    const std::vector<Eigen::Vector3d>& pca_points =
+            use_convex_hull ? hull_points : points;
 
     Eigen::Vector3d mean;
     Eigen::Matrix3d cov;
-    std::tie(mean, cov) = hull_pcd.ComputeMeanAndCovariance();
+    std::tie(mean, cov) = utility::ComputeMeanAndCovariance(pca_points);
 
     Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(cov);
     Eigen::Vector3d evals = es.eigenvalues();
@@ -201,15 +248,17 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
         R.col(1) = tmp;
     }
 
-    for (auto& pt : hull_pcd.points_) {
-        pt = R.transpose() * (pt - mean);
-    }
-    const auto aabox = hull_pcd.GetAxisAlignedBoundingBox();
+    const Eigen::Matrix3d R_inv = R.transpose();
+    Eigen::Vector3d min_bound, max_bound;
+    std::tie(min_bound, max_bound) =
+            ComputeBounds(pca_points, [&](const Eigen::Vector3d& point) {
+                return Eigen::Vector3d(R_inv * (point - mean));
+            });
 
     OrientedBoundingBox obox;
-    obox.center_ = R * aabox.GetCenter() + mean;
+    obox.center_ = R * ((min_bound + max_bound) * 0.5) + mean;
     obox.R_ = R;
-    obox.extent_ = aabox.GetExtent();
+    obox.extent_ = max_bound - min_bound;
 
     return obox;
 }
@@ -309,16 +358,8 @@ AxisAlignedBoundingBox AxisAlignedBoundingBox::CreateFromPoints(
         box.min_bound_ = Eigen::Vector3d(0.0, 0.0, 0.0);
         box.max_bound_ = Eigen::Vector3d(0.0, 0.0, 0.0);
     } else {
-        box.min_bound_ = std::accumulate(
-                points.begin(), points.end(), points[0],
-                [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                    return a.array().min(b.array()).matrix();
-                });
-        box.max_bound_ = std::accumulate(
-                points.begin(), points.end(), points[0],
-                [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                    return a.array().max(b.array()).matrix();
-                });
+        std::tie(box.min_bound_, box.max_bound_) = ComputeBounds(
+                points, [](const Eigen::Vector3d& point) { return point; });
     }
     return box;
 }
@@ -341,16 +382,11 @@ std::vector<Eigen::Vector3d> AxisAlignedBoundingBox::GetBoxPoints() const {
 
 std::vector<size_t> AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBox(
         const std::vector<Eigen::Vector3d>& points) const {
-    std::vector<size_t> indices;
-    for (size_t idx = 0; idx < points.size(); idx++) {
-        const auto& point = points[idx];
-        if (point(0) >= min_bound_(0) && point(0) <= max_bound_(0) &&
-            point(1) >= min_bound_(1) && point(1) <= max_bound_(1) &&
-            point(2) >= min_bound_(2) && point(2) <= max_bound_(2)) {
-            indices.push_back(idx);
-        }
-    }
-    return indices;
+    return SelectPoints(points, [this](const Eigen::Vector3d& point) {
+        return point(0) >= min_bound_(0) && point(0) <= max_bound_(0) &&
+               point(1) >= min_bound_(1) && point(1) <= max_bound_(1) &&
+               point(2) >= min_bound_(2) && point(2) <= max_bound_(2);
+    });
 }
 
 }  // namespace geometry
@@ -105,8 +105,15 @@ public:
     /// bounding box that could be computed for example with O'Rourke's
     /// algorithm (cf. http://cs.smith.edu/~jorourke/Papers/MinVolBox.pdf,
     /// https://www.geometrictools.com/Documentation/MinimumVolumeBox.pdf)
+    ///
+    /// \param points A list of points.
+    /// \param use_convex_hull If true, the PCA is computed on the vertices of
+    /// the convex hull of \p points. If false, it is computed on all points
+    /// directly, which avoids the hull computation but lets dense regions
+    /// bias the orientation.
     static OrientedBoundingBox CreateFromPoints(
-            const std::vector<Eigen::Vector3d>& points);
+            const std::vector<Eigen::Vector3d>& points,
+            bool use_convex_hull = true);
 
 public:
     /// The center point of the bounding box.
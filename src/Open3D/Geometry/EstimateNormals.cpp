@@ -25,10 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 
@@ -218,36 +222,25 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
 }
 
 Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
-                              const std::vector<int> &indices,
+                              const int *indices,
+                              int num_indices,
                               bool fast_normal_computation) {
-    if (indices.size() == 0) {
+    if (num_indices == 0) {
         return Eigen::Vector3d::Zero();
     }
-    Eigen::Matrix3d covariance;
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
-    for (size_t i = 0; i < indices.size(); i++) {
-        const Eigen::Vector3d &point = cloud.points_[indices[i]];
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
+    // Moments are accumulated relative to the first neighbor, which keeps
+    // E[xx] - E[x]E[x] well conditioned for clouds far from the origin.
+    const Eigen::Vector3d &origin = cloud.points_[indices[0]];
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d sum_outer = Eigen::Matrix3d::Zero();
+    for (int i = 0; i < num_indices; i++) {
+        const Eigen::Vector3d point = cloud.points_[indices[i]] - origin;
+        sum += point;
+        sum_outer.noalias() += point * point.transpose();
     }
-    cumulants /= (double)indices.size();
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
+    const Eigen::Vector3d mean = sum / double(num_indices);
+    Eigen::Matrix3d covariance =
+            sum_outer / double(num_indices) - mean * mean.transpose();
 
     if (fast_normal_computation) {
         return FastEigen3x3(covariance);
@@ -258,6 +251,29 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+/// Edge of the Riemannian graph used for normal orientation.
+struct OrientationEdge {
+    float weight_;
+    int v0_;
+    int v1_;
+
+    bool operator<(const OrientationEdge &other) const {
+        return std::tie(weight_, v0_, v1_) <
+               std::tie(other.weight_, other.v0_, other.v1_);
+    }
+    bool operator==(const OrientationEdge &other) const {
+        return v0_ == other.v0_ && v1_ == other.v1_;
+    }
+};
+
+int FindRoot(std::vector<int> &parents, int v) {
+    while (parents[v] != v) {
+        parents[v] = parents[parents[v]];
+        v = parents[v];
+    }
+    return v;
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -265,21 +281,31 @@ namespace geometry {
 bool PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
+    NeighborhoodGraph neighborhood(*this, search_param);
+    return EstimateNormals(neighborhood, fast_normal_computation);
+}
+
+bool PointCloud::EstimateNormals(const NeighborhoodGraph &neighborhood,
+                                 bool fast_normal_computation /* = true */) {
+    if (neighborhood.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[EstimateNormals] The neighborhood graph has {} points, but "
+                "the point cloud has {}.",
+                neighborhood.NumPoints(), points_.size());
+    }
     bool has_normal = HasNormals();
     if (HasNormals() == false) {
         normals_.resize(points_.size());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
         Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
+        int num_neighbors = neighborhood.NumNeighbors(i);
+        if (num_neighbors >= 3) {
+            normal = ComputeNormal(*this, neighborhood.NeighborIndices(i),
+                                   num_neighbors, fast_normal_computation);
             if (normal.norm() == 0.0) {
                 if (has_normal) {
                     normal = normals_[i];
@@ -347,5 +373,114 @@ bool PointCloud::OrientNormalsTowardsCameraLocation(
     }
     return true;
 }
+
+bool PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (HasNormals() == false) {
+        utility::LogWarning(
+                "[OrientNormalsConsistentTangentPlane] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+        return false;
+    }
+    int num_points = int(points_.size());
+    if (num_points < 2) {
+        return true;
+    }
+
+    // Riemannian graph: undirected kNN edges, each stored once with v0 < v1.
+    NeighborhoodGraph neighborhood(*this, KDTreeSearchParamKNN(int(k) + 1));
+    std::vector<OrientationEdge> edges(neighborhood.indices_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        const int *indices = neighborhood.NeighborIndices(i);
+        for (int n = 0; n < neighborhood.NumNeighbors(i); n++) {
+            OrientationEdge &edge = edges[neighborhood.offsets_[i] + n];
+            int j = indices[n];
+            edge.v0_ = std::min(i, j);
+            edge.v1_ = std::max(i, j);
+            edge.weight_ = float(
+                    1.0 - std::abs(normals_[edge.v0_].dot(normals_[edge.v1_])));
+        }
+    }
+    // Both directions of an edge have the same weight, so duplicates become
+    // adjacent after sorting.
+    utility::ParallelSort(edges);
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // Kruskal's algorithm with a union-find forest.
+    std::vector<int> parents(num_points);
+    std::iota(parents.begin(), parents.end(), 0);
+    std::vector<int> degrees(num_points, 0);
+    std::vector<std::pair<int, int>> tree_edges;
+    tree_edges.reserve(num_points - 1);
+    for (const auto &edge : edges) {
+        if (edge.v0_ == edge.v1_) {
+            continue;
+        }
+        int root0 = FindRoot(parents, edge.v0_);
+        int root1 = FindRoot(parents, edge.v1_);
+        if (root0 != root1) {
+            parents[root1] = root0;
+            tree_edges.emplace_back(edge.v0_, edge.v1_);
+            degrees[edge.v0_]++;
+            degrees[edge.v1_]++;
+            if (int(tree_edges.size()) == num_points - 1) {
+                break;
+            }
+        }
+    }
+    std::vector<OrientationEdge>().swap(edges);
+
+    // Spanning forest adjacency in CSR form.
+    std::vector<int> offsets(num_points + 1, 0);
+    for (int i = 0; i < num_points; i++) {
+        offsets[i + 1] = offsets[i] + degrees[i];
+    }
+    std::vector<int> adjacency(offsets[num_points]);
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (const auto &edge : tree_edges) {
+        adjacency[fill[edge.first]++] = edge.second;
+        adjacency[fill[edge.second]++] = edge.first;
+    }
+
+    // Every component is rooted at its highest point, oriented towards +z.
+    std::vector<int> roots(num_points, -1);
+    for (int i = 0; i < num_points; i++) {
+        int root = FindRoot(parents, i);
+        if (roots[root] < 0 || points_[i](2) > points_[roots[root]](2)) {
+            roots[root] = i;
+        }
+    }
+    std::vector<char> visited(num_points, 0);
+    std::vector<int> queue;
+    queue.reserve(num_points);
+    for (int r = 0; r < num_points; r++) {
+        int root = roots[r];
+        if (root < 0) {
+            continue;
+        }
+        if (normals_[root](2) < 0.0) {
+            normals_[root] *= -1.0;
+        }
+        visited[root] = 1;
+        queue.push_back(root);
+        for (size_t head = queue.size() - 1; head < queue.size(); head++) {
+            int v = queue[head];
+            for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+                int u = adjacency[a];
+                if (visited[u]) {
+                    continue;
+                }
+                if (normals_[v].dot(normals_[u]) < 0.0) {
+                    normals_[u] *= -1.0;
+                }
+                visited[u] = 1;
+                queue.push_back(u);
+            }
+        }
+    }
+    return true;
+}
 }  // namespace geometry
 }  // namespace open3d
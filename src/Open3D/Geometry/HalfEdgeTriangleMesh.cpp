@@ -165,11 +165,9 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->triangle_normals_ = mesh.triangle_normals_;
     mesh_cpy->adjacency_list_ = mesh.adjacency_list_;
 
-    // Purge to remove duplications
-    mesh_cpy->RemoveDuplicatedVertices();
-    mesh_cpy->RemoveDuplicatedTriangles();
-    mesh_cpy->RemoveUnreferencedVertices();
-    mesh_cpy->RemoveDegenerateTriangles();
+    // Purge to remove duplications, removing degenerate triangles last so
+    // that vertices only used by them are kept
+    mesh_cpy->CleanMesh(true, false, true, true).RemoveDegenerateTriangles();
 
     // Collect half edges
     // Check: for valid manifolds, there mustn't be duplicated half-edges
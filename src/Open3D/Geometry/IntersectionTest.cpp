@@ -215,5 +215,88 @@ double IntersectionTest::LineSegmentsMinimumDistance(
     return dist;
 }
 
+double IntersectionTest::RayTriangle(const Eigen::Vector3d& origin,
+                                     const Eigen::Vector3d& direction,
+                                     const Eigen::Vector3d& v0,
+                                     const Eigen::Vector3d& v1,
+                                     const Eigen::Vector3d& v2) {
+    const Eigen::Vector3d e1 = v1 - v0;
+    const Eigen::Vector3d e2 = v2 - v0;
+    const Eigen::Vector3d p = direction.cross(e2);
+    double det = e1.dot(p);
+    if (det == 0) {
+        return -1;
+    }
+    double inv_det = 1.0 / det;
+    const Eigen::Vector3d s = origin - v0;
+    double u = s.dot(p) * inv_det;
+    if (u < 0 || u > 1) {
+        return -1;
+    }
+    const Eigen::Vector3d q = s.cross(e1);
+    double v = direction.dot(q) * inv_det;
+    if (v < 0 || u + v > 1) {
+        return -1;
+    }
+    double t = e2.dot(q) * inv_det;
+    return t >= 0 ? t : -1;
+}
+
+Eigen::Vector3d IntersectionTest::PointTriangleClosestPointBarycentric(
+        const Eigen::Vector3d& point,
+        const Eigen::Vector3d& v0,
+        const Eigen::Vector3d& v1,
+        const Eigen::Vector3d& v2) {
+    const Eigen::Vector3d ab = v1 - v0;
+    const Eigen::Vector3d ac = v2 - v0;
+    const Eigen::Vector3d ap = point - v0;
+    double d1 = ab.dot(ap);
+    double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return Eigen::Vector3d(1, 0, 0);
+    }
+    const Eigen::Vector3d bp = point - v1;
+    double d3 = ab.dot(bp);
+    double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return Eigen::Vector3d(0, 1, 0);
+    }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        double v = d1 / (d1 - d3);
+        return Eigen::Vector3d(1 - v, v, 0);
+    }
+    const Eigen::Vector3d cp = point - v2;
+    double d5 = ab.dot(cp);
+    double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return Eigen::Vector3d(0, 0, 1);
+    }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        double w = d2 / (d2 - d6);
+        return Eigen::Vector3d(1 - w, 0, w);
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return Eigen::Vector3d(0, 1 - w, w);
+    }
+    double denom = 1.0 / (va + vb + vc);
+    double v = vb * denom;
+    double w = vc * denom;
+    return Eigen::Vector3d(1 - v - w, v, w);
+}
+
+Eigen::Vector3d IntersectionTest::PointTriangleClosestPoint(
+        const Eigen::Vector3d& point,
+        const Eigen::Vector3d& v0,
+        const Eigen::Vector3d& v1,
+        const Eigen::Vector3d& v2) {
+    Eigen::Vector3d barycentric =
+            PointTriangleClosestPointBarycentric(point, v0, v1, v2);
+    return barycentric(0) * v0 + barycentric(1) * v1 + barycentric(2) * v2;
+}
+
 }  // namespace geometry
 }  // namespace open3d
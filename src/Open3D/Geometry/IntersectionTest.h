@@ -77,6 +77,37 @@ public:
                                               const Eigen::Vector3d& p1,
                                               const Eigen::Vector3d& q0,
                                               const Eigen::Vector3d& q1);
+
+    /// Computes the intersection of a ray with a triangle using the algorithm
+    /// of Moeller and Trumbore. The ray starts at \param origin and points
+    /// along \param direction, the triangle is defined by the 3D points
+    /// \param v0, \param v1 and \param v2. Returns the ray parameter t of the
+    /// intersection point origin + t * direction, or a negative value if the
+    /// ray misses the triangle.
+    static double RayTriangle(const Eigen::Vector3d& origin,
+                              const Eigen::Vector3d& direction,
+                              const Eigen::Vector3d& v0,
+                              const Eigen::Vector3d& v1,
+                              const Eigen::Vector3d& v2);
+
+    /// Computes the barycentric coordinates, with respect to \param v0,
+    /// \param v1 and \param v2, of the point of that triangle closest to
+    /// \param point. Coordinates of vertices that do not contribute, because
+    /// the closest point is on an edge or a vertex, are exactly zero. This
+    /// implementation follows Ericson, 'Real-Time Collision Detection', 2004.
+    static Eigen::Vector3d PointTriangleClosestPointBarycentric(
+            const Eigen::Vector3d& point,
+            const Eigen::Vector3d& v0,
+            const Eigen::Vector3d& v1,
+            const Eigen::Vector3d& v2);
+
+    /// Computes the point of the triangle defined by the 3D points \param v0,
+    /// \param v1 and \param v2 that is closest to \param point.
+    static Eigen::Vector3d PointTriangleClosestPoint(
+            const Eigen::Vector3d& point,
+            const Eigen::Vector3d& v0,
+            const Eigen::Vector3d& v1,
+            const Eigen::Vector3d& v2);
 };
 
 }  // namespace geometry
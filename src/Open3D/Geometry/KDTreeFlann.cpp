@@ -41,6 +41,41 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Result set that only counts the points inside the search radius. Once
+/// max_count points are found the worst distance drops below zero, which
+/// makes the tree traversal prune all remaining branches.
+class CountRadiusResultSet : public flann::ResultSet<double> {
+public:
+    CountRadiusResultSet(double radius2, int max_count)
+        : radius2_(radius2), max_count_(max_count) {}
+
+    bool full() const override { return true; }
+
+    void addPoint(double dist, size_t index) override {
+        if (dist < radius2_) {
+            count_++;
+        }
+    }
+
+    double worstDist() const override {
+        if (max_count_ > 0 && count_ >= max_count_) {
+            return -1.0;
+        }
+        return radius2_;
+    }
+
+    int GetCount() const { return count_; }
+
+private:
+    double radius2_;
+    int max_count_;
+    int count_ = 0;
+};
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
@@ -186,6 +221,26 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+template <typename T>
+int KDTreeFlann::CountRadius(const T &query,
+                             double radius,
+                             int max_count) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(query.rows()) != dimension_) {
+        return -1;
+    }
+    // Same single precision radius as SearchRadius() so that both queries
+    // agree on points lying on the boundary.
+    CountRadiusResultSet result(double(float(radius * radius)), max_count);
+    flann_index_->findNeighbors(result, query.data(),
+                                flann::SearchParams(-1, 0.0));
+    int count = result.GetCount();
+    if (max_count > 0 && count > max_count) {
+        count = max_count;
+    }
+    return count;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
@@ -198,7 +253,7 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
            dataset_size_ * dimension_ * sizeof(double));
     flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
                                                    dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
+    flann_index_.reset(new flann::KDTreeSingleIndex<flann::L2<double>>(
             *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
     flann_index_->buildIndex();
     return true;
@@ -225,6 +280,8 @@ template int KDTreeFlann::SearchHybrid<Eigen::Vector3d>(
         int max_nn,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::CountRadius<Eigen::Vector3d>(
+        const Eigen::Vector3d &query, double radius, int max_count) const;
 
 template int KDTreeFlann::Search<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
@@ -247,6 +304,8 @@ template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         int max_nn,
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
+template int KDTreeFlann::CountRadius<Eigen::VectorXd>(
+        const Eigen::VectorXd &query, double radius, int max_count) const;
 
 }  // namespace geometry
 }  // namespace open3d
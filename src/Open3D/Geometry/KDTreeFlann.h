@@ -40,7 +40,7 @@ class Matrix;
 template <typename T>
 struct L2;
 template <typename T>
-class Index;
+class KDTreeSingleIndex;
 }  // namespace flann
 
 namespace open3d {
@@ -109,6 +109,19 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Counts the points within \p radius of \p query without
+    /// collecting their indices or distances.
+    ///
+    /// \param query The query point.
+    /// \param radius Search radius.
+    /// \param max_count If positive, the traversal stops as soon as
+    /// \p max_count points have been found and \p max_count is returned.
+    /// Use it when only a threshold test such as "at least k neighbors" is
+    /// needed.
+    /// \return The number of points found, or -1 on invalid input.
+    template <typename T>
+    int CountRadius(const T &query, double radius, int max_count = -1) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -119,7 +132,7 @@ private:
 protected:
     std::vector<double> data_;
     std::unique_ptr<flann::Matrix<double>> flann_dataset_;
-    std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    std::unique_ptr<flann::KDTreeSingleIndex<flann::L2<double>>> flann_index_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborhoodGraph.h"
+
+#include <algorithm>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+NeighborhoodGraph::NeighborhoodGraph(const PointCloud &cloud,
+                                     const KDTreeSearchParam &search_param) {
+    ComputeNeighborhood(cloud, search_param);
+}
+
+bool NeighborhoodGraph::ComputeNeighborhood(
+        const PointCloud &cloud, const KDTreeSearchParam &search_param) {
+    Clear();
+    if (!cloud.HasPoints()) {
+        offsets_.push_back(0);
+        return true;
+    }
+    KDTreeFlann kdtree(cloud);
+    return ComputeNeighborhood(kdtree, cloud.points_, search_param);
+}
+
+bool NeighborhoodGraph::ComputeNeighborhood(
+        const KDTreeFlann &kdtree,
+        const std::vector<Eigen::Vector3d> &queries,
+        const KDTreeSearchParam &search_param) {
+    Clear();
+    int num_queries = int(queries.size());
+
+    // Upper bounds of the row sizes. Radius queries are counted without
+    // collecting neighbors, which is much cheaper than a full search.
+    std::vector<size_t> capacity(num_queries, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_queries; i++) {
+        int count = 0;
+        switch (search_param.GetSearchType()) {
+            case KDTreeSearchParam::SearchType::Knn:
+                count = ((const KDTreeSearchParamKNN &)search_param).knn_;
+                break;
+            case KDTreeSearchParam::SearchType::Radius:
+                count = kdtree.CountRadius(
+                        queries[i],
+                        ((const KDTreeSearchParamRadius &)search_param)
+                                .radius_);
+                break;
+            case KDTreeSearchParam::SearchType::Hybrid: {
+                const auto &param =
+                        (const KDTreeSearchParamHybrid &)search_param;
+                count = kdtree.CountRadius(queries[i], param.radius_,
+                                           param.max_nn_);
+                break;
+            }
+            default:
+                count = -1;
+        }
+        capacity[i] = size_t(std::max(count, 0));
+    }
+    offsets_.resize(num_queries + 1);
+    offsets_[0] = 0;
+    for (int i = 0; i < num_queries; i++) {
+        offsets_[i + 1] = offsets_[i] + capacity[i];
+    }
+    indices_.resize(offsets_[num_queries]);
+    distance2_.resize(offsets_[num_queries]);
+
+    // Fill every row in place; the search buffers are reused per thread.
+    std::vector<size_t> sizes(num_queries, 0);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < num_queries; i++) {
+            if (capacity[i] == 0) {
+                continue;
+            }
+            int k = kdtree.Search(queries[i], search_param, indices,
+                                  distance2);
+            size_t n = std::min(size_t(std::max(k, 0)), capacity[i]);
+            std::copy(indices.begin(), indices.begin() + n,
+                      indices_.begin() + offsets_[i]);
+            std::copy(distance2.begin(), distance2.begin() + n,
+                      distance2_.begin() + offsets_[i]);
+            sizes[i] = n;
+        }
+#ifdef _OPENMP
+    }
+#endif
+
+    // KNN rows are short when the tree has fewer than knn points; squeeze
+    // out the unused tail of such rows.
+    if (sizes != capacity) {
+        size_t end = 0;
+        for (int i = 0; i < num_queries; i++) {
+            size_t begin = offsets_[i];
+            std::copy(indices_.begin() + begin,
+                      indices_.begin() + begin + sizes[i],
+                      indices_.begin() + end);
+            std::copy(distance2_.begin() + begin,
+                      distance2_.begin() + begin + sizes[i],
+                      distance2_.begin() + end);
+            offsets_[i] = end;
+            end += sizes[i];
+        }
+        offsets_[num_queries] = end;
+        indices_.resize(end);
+        distance2_.resize(end);
+    }
+    return true;
+}
+
+void NeighborhoodGraph::Clear() {
+    offsets_.clear();
+    indices_.clear();
+    distance2_.clear();
+}
+
+}  // namespace geometry
+}  // namespace open3d
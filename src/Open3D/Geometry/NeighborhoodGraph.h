@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class KDTreeFlann;
+class PointCloud;
+
+/// \class NeighborhoodGraph
+///
+/// \brief Neighbors of every point of a point cloud, stored in compressed
+/// sparse row (CSR) form.
+///
+/// The graph is built once with a single KDTree and can be shared by
+/// EstimateNormals, ComputeFPFHFeature and RegistrationColoredICP when they
+/// use the same search parameters on the same cloud. The neighbors of point i
+/// are indices_[offsets_[i]] ... indices_[offsets_[i + 1] - 1], ordered by
+/// increasing distance, so the first neighbor is usually the point itself.
+class NeighborhoodGraph {
+public:
+    /// \brief Default Constructor.
+    NeighborhoodGraph() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud The point cloud whose neighborhoods are computed.
+    /// \param search_param KNN, radius or hybrid search parameters.
+    NeighborhoodGraph(const PointCloud &cloud,
+                      const KDTreeSearchParam &search_param);
+    ~NeighborhoodGraph() {}
+
+public:
+    /// Computes the neighborhoods of all points of \p cloud.
+    ///
+    /// \param cloud The point cloud whose neighborhoods are computed.
+    /// \param search_param KNN, radius or hybrid search parameters.
+    bool ComputeNeighborhood(const PointCloud &cloud,
+                             const KDTreeSearchParam &search_param);
+    /// Computes the neighborhoods of \p queries in a prebuilt \p kdtree.
+    ///
+    /// \param kdtree KDTree of the searched points.
+    /// \param queries Query points, one row of the graph per query.
+    /// \param search_param KNN, radius or hybrid search parameters.
+    bool ComputeNeighborhood(const KDTreeFlann &kdtree,
+                             const std::vector<Eigen::Vector3d> &queries,
+                             const KDTreeSearchParam &search_param);
+    /// Removes all neighborhoods.
+    void Clear();
+    /// Returns the number of points (rows) in the graph.
+    size_t NumPoints() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the number of neighbors of point \p i.
+    int NumNeighbors(size_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Returns a pointer to the neighbor indices of point \p i.
+    const int *NeighborIndices(size_t i) const {
+        return indices_.data() + offsets_[i];
+    }
+    /// Returns a pointer to the squared neighbor distances of point \p i.
+    const double *NeighborDistance2(size_t i) const {
+        return distance2_.data() + offsets_[i];
+    }
+
+public:
+    /// Row offsets, of size NumPoints() + 1.
+    std::vector<size_t> offsets_;
+    /// Neighbor indices of all points, concatenated.
+    std::vector<int> indices_;
+    /// Squared neighbor distances, parallel to indices_.
+    std::vector<double> distance2_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -29,11 +29,17 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
 #include <numeric>
+#include <unordered_map>
 
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -119,29 +125,183 @@ PointCloud PointCloud::operator+(const PointCloud &cloud) const {
     return (PointCloud(*this) += cloud);
 }
 
-std::vector<double> PointCloud::ComputePointCloudDistance(
-        const PointCloud &target) {
-    std::vector<double> distances(points_.size());
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
+namespace {
+
+/// \class NearestNeighborGrid
+///
+/// \brief Uniform hash grid over a point set with cell size equal to the
+/// search cutoff, so that the nearest point within the cutoff of any query is
+/// in the 3 x 3 x 3 cells around the query.
+class NearestNeighborGrid {
+public:
+    NearestNeighborGrid(const std::vector<Eigen::Vector3d> &points,
+                        double cell_size)
+        : points_(points), inv_cell_size_(1.0 / cell_size) {
+        int num_points = int(points.size());
+        origin_ = points[0];
+        for (const auto &point : points) {
+            origin_ = origin_.cwiseMin(point);
+        }
+        std::vector<Eigen::Vector3i> keys(num_points);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
+        for (int i = 0; i < num_points; i++) {
+            keys[i] = Key(points[i]);
+        }
+        order_.resize(num_points);
+        std::iota(order_.begin(), order_.end(), 0);
+        std::sort(order_.begin(), order_.end(), [&keys](int a, int b) {
+            return std::lexicographical_compare(keys[a].data(),
+                                                keys[a].data() + 3,
+                                                keys[b].data(),
+                                                keys[b].data() + 3);
+        });
+        cells_.reserve(num_points);
+        for (int i = 0; i < num_points;) {
+            const Eigen::Vector3i &key = keys[order_[i]];
+            int end = i + 1;
+            while (end < num_points && keys[order_[end]] == key) {
+                end++;
+            }
+            cells_[key] = std::make_pair(i, end);
+            i = end;
+        }
+    }
+
+    /// Returns the index of the nearest point with squared distance less
+    /// than \p max_distance2 from \p query, or -1 if there is none.
+    int FindNearest(const Eigen::Vector3d &query,
+                    double max_distance2,
+                    double &distance2) const {
+        Eigen::Vector3i key = Key(query);
+        int nearest = -1;
+        distance2 = max_distance2;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto it = cells_.find(key + Eigen::Vector3i(dx, dy, dz));
+                    if (it == cells_.end()) {
+                        continue;
+                    }
+                    for (int i = it->second.first; i < it->second.second;
+                         i++) {
+                        double d2 = (points_[order_[i]] - query).squaredNorm();
+                        if (d2 < distance2 ||
+                            (d2 == distance2 && nearest >= 0 &&
+                             order_[i] < nearest)) {
+                            distance2 = d2;
+                            nearest = order_[i];
+                        }
+                    }
+                }
+            }
+        }
+        return nearest;
+    }
+
+private:
+    /// Cell coordinates are clamped to a range that fits into an int with
+    /// room for the neighbor offsets. Clamping is monotonic, so points within
+    /// one cell of each other still get keys at most one apart.
+    Eigen::Vector3i Key(const Eigen::Vector3d &point) const {
+        const double limit = double(1 << 30);
+        Eigen::Vector3d coord = ((point - origin_) * inv_cell_size_)
+                                        .cwiseMax(-limit)
+                                        .cwiseMin(limit);
+        return Eigen::Vector3i(int(std::floor(coord(0))),
+                               int(std::floor(coord(1))),
+                               int(std::floor(coord(2))));
+    }
+
+    const std::vector<Eigen::Vector3d> &points_;
+    double inv_cell_size_;
+    Eigen::Vector3d origin_;
+    /// Point indices sorted by cell.
+    std::vector<int> order_;
+    /// Range of every occupied cell in order_.
+    std::unordered_map<Eigen::Vector3i,
+                       std::pair<int, int>,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            cells_;
+};
+
+}  // namespace
+
+std::vector<double> PointCloud::ComputePointCloudDistance(
+        const PointCloud &target) {
+    std::vector<double> distances;
+    std::vector<int> indices;
+    std::tie(distances, indices) = ComputePointCloudDistance(target, 0.0);
+    for (size_t i = 0; i < indices.size(); i++) {
+        if (indices[i] < 0) {
             utility::LogDebug(
                     "[ComputePointCloudToPointCloudDistance] Found a point "
                     "without neighbors.");
             distances[i] = 0.0;
-        } else {
-            distances[i] = std::sqrt(dists[0]);
         }
     }
     return distances;
 }
 
+std::tuple<std::vector<double>, std::vector<int>>
+PointCloud::ComputePointCloudDistance(const PointCloud &target,
+                                      double max_distance,
+                                      bool use_grid /* = false*/) const {
+    int num_points = int(points_.size());
+    std::vector<double> distances(num_points,
+                                  std::numeric_limits<double>::infinity());
+    std::vector<int> indices(num_points, -1);
+    if (num_points == 0 || !target.HasPoints()) {
+        return std::make_tuple(distances, indices);
+    }
+    bool has_cutoff = max_distance > 0.0;
+    if (use_grid && has_cutoff) {
+        NearestNeighborGrid grid(target.points_, max_distance);
+        // KDTreeFlann::SearchHybrid compares against the squared radius
+        // rounded to float, so the same cutoff is used here.
+        double max_distance2 = double(float(max_distance * max_distance));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            double distance2;
+            indices[i] = grid.FindNearest(points_[i], max_distance2, distance2);
+            if (indices[i] >= 0) {
+                distances[i] = std::sqrt(distance2);
+            }
+        }
+        return std::make_tuple(distances, indices);
+    }
+
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> nn_indices(1);
+        std::vector<double> nn_dists(1);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < num_points; i++) {
+            // A radius bounded search prunes every branch beyond the cutoff.
+            int k = has_cutoff ? kdtree.SearchHybrid(points_[i], max_distance,
+                                                     1, nn_indices, nn_dists)
+                               : kdtree.SearchKNN(points_[i], 1, nn_indices,
+                                                  nn_dists);
+            if (k > 0) {
+                indices[i] = nn_indices[0];
+                distances[i] = std::sqrt(nn_dists[0]);
+            }
+        }
+#ifdef _OPENMP
+    }
+#endif
+    return std::make_tuple(distances, indices);
+}
+
 PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
                                               bool remove_infinite) {
     bool has_normal = HasNormals();
@@ -171,30 +331,79 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
     return *this;
 }
 
-std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
-        const std::vector<size_t> &indices, bool invert /* = false */) const {
-    auto output = std::make_shared<PointCloud>();
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
+namespace {
 
-    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
+std::vector<char> SelectionMask(const std::vector<size_t> &indices,
+                                size_t num_points,
+                                bool invert) {
+    std::vector<char> mask(num_points, invert ? 1 : 0);
     for (size_t i : indices) {
-        mask[i] = !invert;
+        if (i >= num_points) {
+            utility::LogError(
+                    "[SelectByIndex] Index {} out of range for {} points.", i,
+                    num_points);
+        }
+        mask[i] = invert ? 0 : 1;
     }
+    return mask;
+}
 
-    for (size_t i = 0; i < points_.size(); i++) {
+/// Moves the selected elements to the front of \p values, preserving their
+/// order, and shrinks it. Elements only move towards the front, so a single
+/// forward pass needs no extra buffer.
+template <typename T>
+void CompactInPlace(std::vector<T> &values, const std::vector<char> &mask) {
+    size_t cnt = 0;
+    for (size_t i = 0; i < mask.size(); i++) {
         if (mask[i]) {
-            output->points_.push_back(points_[i]);
-            if (has_normals) output->normals_.push_back(normals_[i]);
-            if (has_colors) output->colors_.push_back(colors_[i]);
+            if (cnt != i) values[cnt] = values[i];
+            cnt++;
         }
     }
+    values.resize(cnt);
+}
+
+}  // namespace
+
+std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
+        const std::vector<size_t> &indices, bool invert /* = false */) const {
+    auto output = std::make_shared<PointCloud>();
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+
+    std::vector<size_t> selected = utility::NonZeroIndices(
+            SelectionMask(indices, points_.size(), invert));
+    int num_selected = int(selected.size());
+    output->points_.resize(num_selected);
+    if (has_normals) output->normals_.resize(num_selected);
+    if (has_colors) output->colors_.resize(num_selected);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_selected; i++) {
+        output->points_[i] = points_[selected[i]];
+        if (has_normals) output->normals_[i] = normals_[selected[i]];
+        if (has_colors) output->colors_[i] = colors_[selected[i]];
+    }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
     return output;
 }
 
+PointCloud &PointCloud::SelectByIndexInPlace(const std::vector<size_t> &indices,
+                                             bool invert /* = false */) {
+    size_t old_point_num = points_.size();
+    std::vector<char> mask = SelectionMask(indices, old_point_num, invert);
+    CompactInPlace(points_, mask);
+    if (normals_.size() == old_point_num) CompactInPlace(normals_, mask);
+    if (colors_.size() == old_point_num) CompactInPlace(colors_, mask);
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)old_point_num, (int)points_.size());
+    return *this;
+}
+
 // helper classes for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
 class AccumulatedPoint {
@@ -295,6 +504,27 @@ private:
     std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
+
+/// Sums func(values[i]) over fixed size chunks in parallel and adds the
+/// partial sums in chunk order, giving the same result for any thread count.
+template <typename Func>
+double DeterministicSum(const std::vector<double> &values, Func func) {
+    const int chunk_size = 4096;
+    int num_chunks = int((values.size() + chunk_size - 1) / chunk_size);
+    std::vector<double> partial_sums(num_chunks, 0.0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t end = std::min(values.size(), size_t(c + 1) * chunk_size);
+        double sum = 0.0;
+        for (size_t i = size_t(c) * chunk_size; i < end; i++) {
+            sum += func(values[i]);
+        }
+        partial_sums[c] = sum;
+    }
+    return std::accumulate(partial_sums.begin(), partial_sums.end(), 0.0);
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -452,16 +682,17 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
+    // std::vector<bool> packs bits and cannot be written concurrently.
+    std::vector<char> mask(points_.size(), 0);
+    // Only the threshold matters, so stop counting after nb_points + 1.
+    const int max_count = int(nb_points) + 1;
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+        int nb_neighbors =
+                kdtree.CountRadius(points_[i], search_radius, max_count);
+        mask[i] = (nb_neighbors > int(nb_points)) ? 1 : 0;
     }
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
@@ -488,7 +719,6 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
     std::vector<size_t> indices;
-    size_t valid_distances = 0;
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -498,27 +728,29 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
         kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
         double mean = -1.0;
         if (dist.size() > 0u) {
-            valid_distances++;
             std::for_each(dist.begin(), dist.end(),
                           [](double &d) { d = std::sqrt(d); });
             mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
         }
         avg_distances[i] = mean;
     }
+    // Points whose neighbors are all duplicates have an average distance of
+    // zero. They are counted, but they are never kept as inliers.
+    size_t valid_distances = std::count_if(
+            avg_distances.begin(), avg_distances.end(),
+            [](double const &x) { return x >= 0; });
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    double cloud_mean = std::accumulate(
-            avg_distances.begin(), avg_distances.end(), 0.0,
-            [](double const &x, double const &y) { return y > 0 ? x + y : x; });
+    // Partial sums over fixed size chunks are accumulated in chunk order, so
+    // the result does not depend on the number of threads.
+    double cloud_mean = DeterministicSum(
+            avg_distances, [](double x) { return x > 0 ? x : 0.0; });
     cloud_mean /= valid_distances;
-    double sq_sum = std::inner_product(
-            avg_distances.begin(), avg_distances.end(), avg_distances.begin(),
-            0.0, [](double const &x, double const &y) { return x + y; },
-            [cloud_mean](double const &x, double const &y) {
-                return x > 0 ? (x - cloud_mean) * (y - cloud_mean) : 0;
-            });
+    double sq_sum = DeterministicSum(avg_distances, [cloud_mean](double x) {
+        return x > 0 ? (x - cloud_mean) * (x - cloud_mean) : 0.0;
+    });
     // Bessel's correction
     double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
     double distance_threshold = cloud_mean + std_ratio * std_dev;
@@ -536,35 +768,7 @@ PointCloud::ComputeMeanAndCovariance() const {
         return std::make_tuple(Eigen::Vector3d::Zero(),
                                Eigen::Matrix3d::Identity());
     }
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
-    for (const auto &point : points_) {
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
-    }
-    cumulants /= (double)points_.size();
-    Eigen::Vector3d mean;
-    Eigen::Matrix3d covariance;
-    mean(0) = cumulants(0);
-    mean(1) = cumulants(1);
-    mean(2) = cumulants(2);
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
-    return std::make_tuple(mean, covariance);
+    return utility::ComputeMeanAndCovariance(points_);
 }
 
 std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
@@ -609,6 +813,37 @@ PointCloud::ComputeConvexHull() const {
     return Qhull::ComputeConvexHull(points_);
 }
 
+namespace {
+
+/// Spherical flipping of \p point about a sphere of \p radius centered at
+/// \p camera_location, expressed relative to the camera.
+Eigen::Vector3d SphericalFlip(const Eigen::Vector3d &point,
+                              const Eigen::Vector3d &camera_location,
+                              double radius) {
+    Eigen::Vector3d projected_point = point - camera_location;
+    double norm = projected_point.norm();
+    return projected_point + 2 * (radius - norm) * projected_point / norm;
+}
+
+/// Returns the cell of a cube map with \p resolution x \p resolution cells
+/// per face that contains \p direction, or -1 for a zero direction.
+int CubeMapCell(const Eigen::Vector3d &direction, int resolution) {
+    Eigen::Vector3d abs_direction = direction.cwiseAbs();
+    int axis;
+    double major = abs_direction.maxCoeff(&axis);
+    if (major <= 0) {
+        return -1;
+    }
+    int face = 2 * axis + (direction(axis) < 0 ? 1 : 0);
+    double u = direction((axis + 1) % 3) / major;
+    double v = direction((axis + 2) % 3) / major;
+    int cu = std::min(resolution - 1, int((u + 1) * 0.5 * resolution));
+    int cv = std::min(resolution - 1, int((v + 1) * 0.5 * resolution));
+    return (face * resolution + cv) * resolution + cu;
+}
+
+}  // namespace
+
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                                const double radius) const {
@@ -618,17 +853,18 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     }
 
     // perform spherical projection
-    std::vector<Eigen::Vector3d> spherical_projection;
-    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
-        Eigen::Vector3d projected_point = points_[pidx] - camera_location;
-        double norm = projected_point.norm();
-        spherical_projection.push_back(
-                projected_point + 2 * (radius - norm) * projected_point / norm);
+    std::vector<Eigen::Vector3d> spherical_projection(points_.size() + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < (int)points_.size(); ++pidx) {
+        spherical_projection[pidx] =
+                SphericalFlip(points_[pidx], camera_location, radius);
     }
 
     // add origin
-    size_t origin_pidx = spherical_projection.size();
-    spherical_projection.push_back(Eigen::Vector3d(0, 0, 0));
+    size_t origin_pidx = points_.size();
+    spherical_projection[origin_pidx] = Eigen::Vector3d(0, 0, 0);
 
     // calculate convex hull of spherical projection
     std::shared_ptr<TriangleMesh> visible_mesh;
@@ -671,5 +907,136 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     return std::make_tuple(visible_mesh, pt_map);
 }
 
+std::vector<size_t> PointCloud::HiddenPointRemovalBySectors(
+        const Eigen::Vector3d &camera_location,
+        double radius,
+        int sector_resolution) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemovalBySectors] radius must be larger than "
+                "zero.");
+    }
+    if (sector_resolution <= 0) {
+        utility::LogError(
+                "[HiddenPointRemovalBySectors] sector_resolution must be "
+                "larger than zero.");
+    }
+
+    // Bucket the points by the cube map cell of their viewing direction.
+    int num_sectors = 6 * sector_resolution * sector_resolution;
+    std::vector<int> sector(points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < (int)points_.size(); ++pidx) {
+        sector[pidx] = CubeMapCell(points_[pidx] - camera_location,
+                                   sector_resolution);
+    }
+    std::vector<size_t> sector_offsets(num_sectors + 1, 0);
+    for (int s : sector) {
+        if (s >= 0) sector_offsets[s + 1]++;
+    }
+    std::partial_sum(sector_offsets.begin(), sector_offsets.end(),
+                     sector_offsets.begin());
+    std::vector<size_t> sector_points(sector_offsets.back());
+    std::vector<size_t> fill(sector_offsets.begin(), sector_offsets.end() - 1);
+    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+        if (sector[pidx] >= 0) sector_points[fill[sector[pidx]]++] = pidx;
+    }
+
+    // Every sector is a cone with its apex at the camera, so a point on the
+    // hull of all flipped points is also on the hull of its sector. Each
+    // sector thus reports a superset of the exact visible points.
+    std::vector<char> visible(points_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int s = 0; s < num_sectors; s++) {
+        size_t begin = sector_offsets[s];
+        size_t num_points = sector_offsets[s + 1] - begin;
+        if (num_points == 0) continue;
+        std::vector<Eigen::Vector3d> spherical_projection(num_points + 1);
+        for (size_t i = 0; i < num_points; i++) {
+            spherical_projection[i] = SphericalFlip(
+                    points_[sector_points[begin + i]], camera_location, radius);
+        }
+        spherical_projection[num_points] = Eigen::Vector3d(0, 0, 0);
+        bool hull_valid = num_points >= 3;
+        std::vector<size_t> pt_map;
+        if (hull_valid) {
+            try {
+                pt_map = std::get<1>(
+                        Qhull::ComputeConvexHull(spherical_projection));
+            } catch (const std::exception &) {
+                // Degenerate sectors, e.g. coplanar points, have no hull.
+                hull_valid = false;
+            }
+        }
+        if (hull_valid) {
+            for (size_t i : pt_map) {
+                if (i < num_points) visible[sector_points[begin + i]] = 1;
+            }
+        } else {
+            for (size_t i = 0; i < num_points; i++) {
+                visible[sector_points[begin + i]] = 1;
+            }
+        }
+    }
+    return utility::NonZeroIndices(visible);
+}
+
+std::vector<size_t> PointCloud::HiddenPointRemovalZBuffer(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_tolerance) const {
+    int width = intrinsic.width_;
+    int height = intrinsic.height_;
+    if (width <= 0 || height <= 0) {
+        utility::LogError(
+                "[HiddenPointRemovalZBuffer] intrinsic has an empty image "
+                "size.");
+    }
+    const Eigen::Matrix3d &K = intrinsic.intrinsic_matrix_;
+    const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
+
+    // Project all points, then keep the nearest depth per pixel.
+    std::vector<int> pixel(points_.size());
+    std::vector<double> depth(points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < (int)points_.size(); ++pidx) {
+        Eigen::Vector3d p = R * points_[pidx] + t;
+        pixel[pidx] = -1;
+        depth[pidx] = p(2);
+        if (p(2) <= 0) continue;
+        Eigen::Vector3d uvw = K * p;
+        double u = std::floor(uvw(0) / uvw(2) + 0.5);
+        double v = std::floor(uvw(1) / uvw(2) + 0.5);
+        if (u >= 0 && u < width && v >= 0 && v < height) {
+            pixel[pidx] = int(v) * width + int(u);
+        }
+    }
+    std::vector<double> zbuffer(size_t(width) * height,
+                                std::numeric_limits<double>::infinity());
+    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
+        if (pixel[pidx] >= 0) {
+            zbuffer[pixel[pidx]] = std::min(zbuffer[pixel[pidx]], depth[pidx]);
+        }
+    }
+
+    std::vector<char> visible(points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < (int)points_.size(); ++pidx) {
+        visible[pidx] = pixel[pidx] >= 0 &&
+                        depth[pidx] <= zbuffer[pixel[pidx]] *
+                                               (1.0 + depth_tolerance);
+    }
+    return utility::NonZeroIndices(visible);
+}
+
 }  // namespace geometry
 }  // namespace open3d
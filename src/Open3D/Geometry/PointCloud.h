@@ -43,6 +43,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class NeighborhoodGraph;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -128,6 +129,16 @@ public:
     std::shared_ptr<PointCloud> SelectByIndex(
             const std::vector<size_t> &indices, bool invert = false) const;
 
+    /// \brief Function to select points of this pointcloud in place.
+    ///
+    /// Same as SelectByIndex(), but the selected points are compacted within
+    /// the existing buffers instead of being copied to a new pointcloud.
+    ///
+    /// \param indices Indices of points to be selected.
+    /// \param invert Set to `True` to invert the selection of indices.
+    PointCloud &SelectByIndexInPlace(const std::vector<size_t> &indices,
+                                     bool invert = false);
+
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
@@ -208,6 +219,16 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of a point cloud from
+    /// precomputed neighborhoods.
+    ///
+    /// \param neighborhood Neighborhoods of all points of this point cloud,
+    /// e.g. shared with ComputeFPFHFeature. \param fast_normal_computation If
+    /// true, the normal estiamtion uses a non-iterative method to extract the
+    /// eigenvector from the covariance matrix.
+    bool EstimateNormals(const NeighborhoodGraph &neighborhood,
+                         bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -223,6 +244,18 @@ public:
     bool OrientNormalsTowardsCameraLocation(
             const Eigen::Vector3d &camera_location = Eigen::Vector3d::Zero());
 
+    /// \brief Function to consistently orient the normals of a point cloud
+    /// based on tangent planes.
+    ///
+    /// The normals are propagated along a minimum spanning tree of the k
+    /// nearest neighbor graph, whose edges are weighted by 1 - |n_i . n_j|,
+    /// as described in Hoppe et al., "Surface Reconstruction from Unorganized
+    /// Points", 1992. Each connected component is rooted at its highest
+    /// point, whose normal is oriented towards +z.
+    ///
+    /// \param k Number of nearest neighbors used to build the graph.
+    bool OrientNormalsConsistentTangentPlane(size_t k);
+
     /// \brief Function to compute the point to point distances between point
     /// clouds.
     ///
@@ -232,6 +265,24 @@ public:
     /// \param target The target point cloud.
     std::vector<double> ComputePointCloudDistance(const PointCloud &target);
 
+    /// \brief Function to compute the distances and indices of the nearest
+    /// points in another point cloud.
+    ///
+    /// For each point in this point cloud, find the nearest point of \p target
+    /// at a distance less than \p max_distance. Points without such a
+    /// neighbor get distance infinity and index -1, and the search for them
+    /// stops at the cutoff.
+    ///
+    /// \param target The target point cloud.
+    /// \param max_distance Search cutoff, a non-positive value disables it.
+    /// \param use_grid If true and a cutoff is given, a uniform hash grid with
+    /// cell size \p max_distance is used instead of a KDTree. It is faster
+    /// when the cutoff is small compared to the extent of \p target.
+    std::tuple<std::vector<double>, std::vector<int>> ComputePointCloudDistance(
+            const PointCloud &target,
+            double max_distance,
+            bool use_grid = false) const;
+
     /// Function to compute the mean and covariance matrix
     /// of a point cloud.
     std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance()
@@ -264,6 +315,42 @@ public:
     HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                        const double radius) const;
 
+    /// \brief Approximate HiddenPointRemoval() that computes one convex hull
+    /// per sector of viewing directions, in parallel.
+    ///
+    /// The viewing directions are split into the cells of a cube map centered
+    /// at \p camera_location. Every point found by HiddenPointRemoval() is
+    /// also found here; points near sector borders may additionally be
+    /// reported as visible.
+    ///
+    /// \param camera_location All points not visible from that location will
+    /// be removed.
+    /// \param radius The radius of the sperical projection.
+    /// \param sector_resolution Number of sectors along each side of a cube
+    /// map face, giving 6 * sector_resolution^2 sectors.
+    /// \return Indices of the visible points in increasing order.
+    std::vector<size_t> HiddenPointRemovalBySectors(
+            const Eigen::Vector3d &camera_location,
+            double radius,
+            int sector_resolution = 4) const;
+
+    /// \brief Approximate visibility from a pinhole camera using a z-buffer.
+    ///
+    /// Every point is projected into the image, and a point is visible if its
+    /// depth is within \p depth_tolerance of the nearest depth in its pixel.
+    /// The image size of \p intrinsic should match the point density, as
+    /// pixels without a foreground point do not hide anything.
+    ///
+    /// \param intrinsic Intrinsic parameters of the camera.
+    /// \param extrinsic Extrinsic parameters of the camera.
+    /// \param depth_tolerance Relative depth difference below which a point
+    /// is considered to be on the visible surface.
+    /// \return Indices of the visible points in increasing order.
+    std::vector<size_t> HiddenPointRemovalZBuffer(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_tolerance = 0.01) const;
+
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
@@ -271,27 +358,65 @@ public:
     /// Returns a list of point labels, -1 indicates noise according to
     /// the algorithm.
     ///
+    /// With \p use_grid the neighbourhoods are not stored: the points are
+    /// bucketed in a grid of cell size \p eps, core points are detected in
+    /// parallel and merged with a concurrent union-find. Memory is linear in
+    /// the number of points. Border points reachable from several clusters
+    /// join the cluster of their smallest core neighbour.
+    ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
+    /// \param use_grid If `true` use the grid partitioned parallel algorithm.
     std::vector<int> ClusterDBSCAN(double eps,
                                    size_t min_points,
-                                   bool print_progress = false) const;
+                                   bool print_progress = false,
+                                   bool use_grid = false) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are scored in parallel, and the iterations stop early once
+    /// a sample of inliers only has been drawn with the given probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment up to \p max_num_planes planes with RANSAC.
+    ///
+    /// Planes are extracted one after the other as in SegmentPlane(); the
+    /// inliers of each plane are removed before the next one is searched.
+    /// Extraction stops early when a plane has fewer than \p min_num_inliers
+    /// inliers.
+    ///
+    /// \param max_num_planes Maximum number of planes to extract.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param min_num_inliers Minimum number of inliers of a plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models and the indices of their inliers, in
+    /// extraction order.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> SegmentPlanes(
+            const int max_num_planes,
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const size_t min_num_inliers = 3,
+            const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -343,6 +468,46 @@ public:
             const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
             bool project_valid_depth_only = true);
 
+    /// \brief Function to unproject a depth image into this point cloud.
+    ///
+    /// Same as CreateFromDepthImage(), but the existing buffers are reused,
+    /// which avoids reallocation when frames are converted repeatedly. Normals
+    /// and colors are cleared.
+    ///
+    /// \param depth The input depth image can be either a float image, or a
+    /// uint16_t image. \param intrinsic Intrinsic parameters of the camera.
+    /// \param extrinsic Extrinsic parameters of the camera.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_trunc Truncated at \p depth_trunc distance.
+    /// \param stride Sampling factor to support coarse point cloud extraction.
+    /// \param project_valid_depth_only If false, invalid depth results in NaN
+    /// points.
+    bool UpdateFromDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            int stride = 1,
+            bool project_valid_depth_only = true);
+
+    /// \brief Function to unproject an RGB-D image into this point cloud.
+    ///
+    /// Same as CreateFromRGBDImage(), but the existing buffers are reused,
+    /// which avoids reallocation when frames are converted repeatedly. Normals
+    /// are cleared.
+    ///
+    /// \param image The input image.
+    /// \param intrinsic Intrinsic parameters of the camera.
+    /// \param extrinsic Extrinsic parameters of the camera.
+    /// \param project_valid_depth_only If false, invalid depth results in NaN
+    /// points.
+    bool UpdateFromRGBDImage(
+            const RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            bool project_valid_depth_only = true);
+
     /// \brief Function to create a PointCloud from a VoxelGrid.
     ///
     /// It transforms the voxel centers to 3D points using the original point
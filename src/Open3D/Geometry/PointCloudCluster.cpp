@@ -27,21 +27,254 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
 namespace open3d {
+
+namespace {
+using namespace geometry;
+
+/// \class DBSCANGrid
+///
+/// \brief Uniform grid with cell size eps. The points are sorted by cell, and
+/// every cell stores the cells of its 3 x 3 x 3 neighbourhood, so that all the
+/// points within eps of a point are found in the neighbour cells of its cell.
+class DBSCANGrid {
+public:
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points, double eps) {
+        int num_points = int(points.size());
+        Eigen::Vector3d min_bound = points[0];
+        for (const auto &point : points) {
+            min_bound = min_bound.cwiseMin(point);
+        }
+        std::vector<Eigen::Vector3i> keys(num_points);
+        for (int idx = 0; idx < num_points; ++idx) {
+            Eigen::Vector3d coord = (points[idx] - min_bound) / eps;
+            keys[idx] << int(std::floor(coord(0))), int(std::floor(coord(1))),
+                    int(std::floor(coord(2)));
+        }
+        point_order_.resize(num_points);
+        std::iota(point_order_.begin(), point_order_.end(), 0);
+        std::sort(point_order_.begin(), point_order_.end(),
+                  [&keys](int a, int b) {
+                      return std::lexicographical_compare(
+                              keys[a].data(), keys[a].data() + 3,
+                              keys[b].data(), keys[b].data() + 3);
+                  });
+
+        std::unordered_map<Eigen::Vector3i, int,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                key_to_cell;
+        std::vector<Eigen::Vector3i> cell_keys;
+        point_cell_.resize(num_points);
+        for (int i = 0; i < num_points; ++i) {
+            const Eigen::Vector3i &key = keys[point_order_[i]];
+            if (cell_keys.empty() || cell_keys.back() != key) {
+                key_to_cell[key] = int(cell_keys.size());
+                cell_keys.push_back(key);
+                cell_begin_.push_back(i);
+            }
+            point_cell_[point_order_[i]] = int(cell_keys.size()) - 1;
+        }
+        cell_begin_.push_back(num_points);
+
+        neighbor_cell_begin_.push_back(0);
+        for (const auto &key : cell_keys) {
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dz = -1; dz <= 1; dz++) {
+                        auto it = key_to_cell.find(
+                                key + Eigen::Vector3i(dx, dy, dz));
+                        if (it != key_to_cell.end()) {
+                            neighbor_cells_.push_back(it->second);
+                        }
+                    }
+                }
+            }
+            neighbor_cell_begin_.push_back(int(neighbor_cells_.size()));
+        }
+    }
+
+    /// Calls f(j) for every point j within eps of point idx (idx included)
+    /// until f returns false.
+    template <typename Function>
+    void ForEachNeighbor(const std::vector<Eigen::Vector3d> &points,
+                         int idx,
+                         double eps2,
+                         Function f) const {
+        int cell = point_cell_[idx];
+        for (int n = neighbor_cell_begin_[cell];
+             n < neighbor_cell_begin_[cell + 1]; n++) {
+            int nb_cell = neighbor_cells_[n];
+            for (int i = cell_begin_[nb_cell]; i < cell_begin_[nb_cell + 1];
+                 i++) {
+                int j = point_order_[i];
+                if ((points[j] - points[idx]).squaredNorm() < eps2 && !f(j)) {
+                    return;
+                }
+            }
+        }
+    }
+
+private:
+    /// Point indices sorted by cell.
+    std::vector<int> point_order_;
+    /// Cell of every point.
+    std::vector<int> point_cell_;
+    /// Range of every cell in point_order_.
+    std::vector<int> cell_begin_;
+    /// Neighbour cells of every cell, in CSR format.
+    std::vector<int> neighbor_cell_begin_;
+    std::vector<int> neighbor_cells_;
+};
+
+/// Lock-free union-find. Roots are only ever linked to smaller roots with a
+/// compare-and-swap, so concurrent unions cannot create cycles.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parent_(size) {
+        for (int i = 0; i < size; i++) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        while (true) {
+            int p = parent_[x].load();
+            if (p == x) return x;
+            int gp = parent_[p].load();
+            // Path halving, losing the race is harmless.
+            parent_[x].compare_exchange_weak(p, gp);
+            x = gp;
+        }
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) return;
+            if (a < b) std::swap(a, b);
+            int expected = a;
+            if (parent_[a].compare_exchange_strong(expected, b)) return;
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+std::vector<int> ClusterDBSCANGrid(const std::vector<Eigen::Vector3d> &points,
+                                   double eps,
+                                   size_t min_points,
+                                   bool print_progress) {
+    int num_points = int(points.size());
+    std::vector<int> labels(num_points, -1);
+    if (eps <= 0.0) {
+        utility::LogError("[ClusterDBSCAN] eps <= 0.");
+    }
+    if (num_points == 0) return labels;
+    Eigen::Vector3d extent = Eigen::Vector3d::Zero();
+    for (const auto &point : points) {
+        extent = extent.cwiseMax((point - points[0]).cwiseAbs());
+    }
+    if (eps * std::numeric_limits<int>::max() < 2.0 * extent.maxCoeff()) {
+        utility::LogError("[ClusterDBSCAN] eps is too small.");
+    }
+    const double eps2 = eps * eps;
+    DBSCANGrid grid(points, eps);
+
+    // Core points, counting stops as soon as min_points neighbours are found.
+    utility::LogDebug("Compute Core Points");
+    utility::ConsoleProgressBar progress_bar(num_points, "Compute Core Points",
+                                             print_progress);
+    std::vector<char> is_core(num_points, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int idx = 0; idx < num_points; ++idx) {
+        size_t count = 0;
+        grid.ForEachNeighbor(points, idx, eps2, [&](int) {
+            return ++count < min_points;
+        });
+        is_core[idx] = count >= min_points;
+        if (print_progress) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            { ++progress_bar; }
+        }
+    }
+
+    // Merge core points within eps of each other.
+    utility::LogDebug("Compute Clusters");
+    ConcurrentUnionFind union_find(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (!is_core[idx]) continue;
+        grid.ForEachNeighbor(points, idx, eps2, [&](int j) {
+            if (j > idx && is_core[j]) union_find.Union(idx, j);
+            return true;
+        });
+    }
+
+    // Number the clusters by their smallest core point, as in the serial
+    // expansion.
+    std::vector<int> root_label(num_points, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (!is_core[idx]) continue;
+        int root = union_find.Find(idx);
+        if (root_label[root] < 0) root_label[root] = cluster_label++;
+        labels[idx] = root_label[root];
+    }
+
+    // Border points join the cluster of their smallest core neighbour.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) continue;
+        int core = num_points;
+        grid.ForEachNeighbor(points, idx, eps2, [&](int j) {
+            if (is_core[j]) core = std::min(core, j);
+            return true;
+        });
+        if (core < num_points) {
+            labels[idx] = root_label[union_find.Find(core)];
+        }
+    }
+
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    return labels;
+}
+
+}  // unnamed namespace
+
 namespace geometry {
 
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
-                                           bool print_progress) const {
+                                           bool print_progress,
+                                           bool use_grid) const {
+    if (use_grid) {
+        return ClusterDBSCANGrid(points_, eps, min_points, print_progress);
+    }
     KDTreeFlann kdtree(*this);
 
     // precompute all neighbours
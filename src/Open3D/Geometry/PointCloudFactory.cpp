@@ -39,108 +39,151 @@ namespace open3d {
 namespace {
 using namespace geometry;
 
-int CountValidDepthPixels(const Image &depth, int stride) {
-    int num_valid_pixels = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) num_valid_pixels += 1;
+/// Ray directions of a pinhole camera in world coordinates for a strided pixel
+/// grid. The direction of pixel (u, v) is column_terms_[u] + row_terms_[v],
+/// so the table takes O(width + height) memory and a point is
+/// origin_ + depth * direction.
+struct RayTable {
+    RayTable(const camera::PinholeCameraIntrinsic &intrinsic,
+             const Eigen::Matrix4d &extrinsic,
+             int width,
+             int height,
+             int stride) {
+        Eigen::Matrix4d camera_pose = extrinsic.inverse();
+        Eigen::Matrix3d R = camera_pose.block<3, 3>(0, 0);
+        origin_ = camera_pose.block<3, 1>(0, 3);
+        auto focal_length = intrinsic.GetFocalLength();
+        auto principal_point = intrinsic.GetPrincipalPoint();
+        column_terms_.resize((width + stride - 1) / stride);
+        for (size_t c = 0; c < column_terms_.size(); c++) {
+            double x = (int(c) * stride - principal_point.first) /
+                       focal_length.first;
+            column_terms_[c] = R.col(0) * x;
+        }
+        row_terms_.resize((height + stride - 1) / stride);
+        for (size_t r = 0; r < row_terms_.size(); r++) {
+            double y = (int(r) * stride - principal_point.second) /
+                       focal_length.second;
+            row_terms_[r] = R.col(1) * y + R.col(2);
         }
     }
-    return num_valid_pixels;
-}
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
-        const Image &depth,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        int stride,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels =
-                int(depth.height_ / stride) * int(depth.width_ / stride);
-    } else {
-        num_valid_pixels = CountValidDepthPixels(depth, stride);
-    }
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
-            } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt++] = Eigen::Vector3d(x, y, z);
-            }
+    Eigen::Vector3d origin_;
+    std::vector<Eigen::Vector3d> column_terms_;
+    std::vector<Eigen::Vector3d> row_terms_;
+};
+
+/// Reads metric depth from a float image, or from a uint16_t image with the
+/// same scaling and truncation as Image::ConvertDepthToFloatImage().
+class DepthReader {
+public:
+    DepthReader(const Image &depth, double depth_scale, double depth_trunc)
+        : data_(depth.data_.data()),
+          bytes_per_line_(depth.BytesPerLine()),
+          is_float_(depth.bytes_per_channel_ == 4),
+          depth_scale_(float(depth_scale)),
+          depth_trunc_(depth_trunc) {}
+
+    float operator()(int u, int v) const {
+        const uint8_t *row = data_ + size_t(v) * bytes_per_line_;
+        if (is_float_) {
+            return ((const float *)row)[u];
         }
+        float d = float(((const uint16_t *)row)[u]) / depth_scale_;
+        return (d >= depth_trunc_) ? 0.0f : d;
     }
-    return pointcloud;
-}
 
+private:
+    const uint8_t *data_;
+    int bytes_per_line_;
+    bool is_float_;
+    float depth_scale_;
+    double depth_trunc_;
+};
+
+/// Unprojects a depth image into \p pointcloud, reusing its buffers. Rows are
+/// processed in parallel: valid pixels are counted per row, an exclusive
+/// prefix sum gives each row its output offset, and rows are then filled
+/// independently. If \p color is given, colors are read with TC and NC.
 template <typename TC, int NC>
-std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
-        const RGBDImage &image,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
+void UnprojectDepthImage(const DepthReader &depth,
+                         int depth_width,
+                         int depth_height,
+                         const Image *color,
+                         const camera::PinholeCameraIntrinsic &intrinsic,
+                         const Eigen::Matrix4d &extrinsic,
+                         int stride,
+                         bool project_valid_depth_only,
+                         PointCloud &pointcloud) {
+    RayTable rays(intrinsic, extrinsic, depth_width, depth_height, stride);
+    int width = int(rays.column_terms_.size());
+    int height = int(rays.row_terms_.size());
     double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels = image.depth_.height_ * image.depth_.width_;
+
+    std::vector<size_t> row_offsets(height + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int r = 0; r < height; r++) {
+        if (!project_valid_depth_only) {
+            row_offsets[r + 1] = width;
+            continue;
+        }
+        size_t count = 0;
+        for (int c = 0; c < width; c++) {
+            if (depth(c * stride, r * stride) > 0) count++;
+        }
+        row_offsets[r + 1] = count;
+    }
+    for (int r = 0; r < height; r++) {
+        row_offsets[r + 1] += row_offsets[r];
+    }
+
+    pointcloud.points_.resize(row_offsets[height]);
+    pointcloud.normals_.clear();
+    if (color != nullptr) {
+        pointcloud.colors_.resize(row_offsets[height]);
     } else {
-        num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
+        pointcloud.colors_.clear();
     }
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < image.depth_.height_; i++) {
-        float *p = (float *)(image.depth_.data_.data() +
-                             i * image.depth_.BytesPerLine());
-        TC *pc = (TC *)(image.color_.data_.data() +
-                        i * image.color_.BytesPerLine());
-        for (int j = 0; j < image.depth_.width_; j++, p++, pc += NC) {
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
-                        scale;
+    const double nan = std::numeric_limits<float>::quiet_NaN();
+    const double color_nan = std::numeric_limits<TC>::quiet_NaN();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int r = 0; r < height; r++) {
+        const Eigen::Vector3d &row_term = rays.row_terms_[r];
+        const TC *color_row =
+                (color != nullptr)
+                        ? (const TC *)(color->data_.data() +
+                                       size_t(r) * stride *
+                                               color->BytesPerLine())
+                        : nullptr;
+        size_t cnt = row_offsets[r];
+        for (int c = 0; c < width; c++) {
+            float d = depth(c * stride, r * stride);
+            if (d > 0) {
+                pointcloud.points_[cnt] =
+                        rays.origin_ +
+                        double(d) * (rays.column_terms_[c] + row_term);
+                if (color != nullptr) {
+                    const TC *pc = color_row + size_t(c) * stride * NC;
+                    pointcloud.colors_[cnt] =
+                            Eigen::Vector3d(pc[0], pc[(NC - 1) / 2],
+                                            pc[NC - 1]) /
+                            scale;
+                }
+                cnt++;
             } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt] = Eigen::Vector3d(x, y, z);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(std::numeric_limits<TC>::quiet_NaN(),
-                                        std::numeric_limits<TC>::quiet_NaN(),
-                                        std::numeric_limits<TC>::quiet_NaN());
+                pointcloud.points_[cnt] = Eigen::Vector3d(nan, nan, nan);
+                if (color != nullptr) {
+                    pointcloud.colors_[cnt] =
+                            Eigen::Vector3d(color_nan, color_nan, color_nan);
+                }
+                cnt++;
             }
         }
     }
-    return pointcloud;
 }
 
 }  // unnamed namespace
@@ -154,22 +197,11 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
         double depth_trunc /* = 1000.0*/,
         int stride /* = 1*/,
         bool project_valid_depth_only) {
-    if (depth.num_of_channels_ == 1) {
-        if (depth.bytes_per_channel_ == 2) {
-            auto float_depth =
-                    depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(
-                    *float_depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(
-                    depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        }
-    }
-    utility::LogError(
-            "[CreatePointCloudFromDepthImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+    auto pointcloud = std::make_shared<PointCloud>();
+    pointcloud->UpdateFromDepthImage(depth, intrinsic, extrinsic, depth_scale,
+                                     depth_trunc, stride,
+                                     project_valid_depth_only);
+    return pointcloud;
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
@@ -177,21 +209,63 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
         bool project_valid_depth_only) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    pointcloud->UpdateFromRGBDImage(image, intrinsic, extrinsic,
+                                    project_valid_depth_only);
+    return pointcloud;
+}
+
+bool PointCloud::UpdateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/,
+        bool project_valid_depth_only /* = true*/) {
+    if (depth.num_of_channels_ != 1 || (depth.bytes_per_channel_ != 2 &&
+                                        depth.bytes_per_channel_ != 4)) {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+    }
+    if (stride < 1) {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] stride must be positive.");
+    }
+    UnprojectDepthImage<uint8_t, 3>(
+            DepthReader(depth, depth_scale, depth_trunc), depth.width_,
+            depth.height_, nullptr, intrinsic, extrinsic, stride,
+            project_valid_depth_only, *this);
+    return true;
+}
+
+bool PointCloud::UpdateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        bool project_valid_depth_only /* = true*/) {
     if (image.depth_.num_of_channels_ == 1 &&
         image.depth_.bytes_per_channel_ == 4) {
+        DepthReader depth(image.depth_, 1.0, 0.0);
         if (image.color_.bytes_per_channel_ == 1 &&
             image.color_.num_of_channels_ == 3) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(
-                    image, intrinsic, extrinsic, project_valid_depth_only);
+            UnprojectDepthImage<uint8_t, 3>(
+                    depth, image.depth_.width_, image.depth_.height_,
+                    &image.color_, intrinsic, extrinsic, 1,
+                    project_valid_depth_only, *this);
+            return true;
         } else if (image.color_.bytes_per_channel_ == 4 &&
                    image.color_.num_of_channels_ == 1) {
-            return CreatePointCloudFromRGBDImageT<float, 1>(
-                    image, intrinsic, extrinsic, project_valid_depth_only);
+            UnprojectDepthImage<float, 1>(
+                    depth, image.depth_.width_, image.depth_.height_,
+                    &image.color_, intrinsic, extrinsic, 1,
+                    project_valid_depth_only, *this);
+            return true;
         }
     }
     utility::LogError(
             "[CreatePointCloudFromRGBDImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+    return false;
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <numeric>
 #include <random>
@@ -35,6 +36,7 @@
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -44,64 +46,99 @@ namespace geometry {
 /// \brief Stores the current best result in the RANSAC algorithm.
 class RANSACResult {
 public:
-    RANSACResult() : fitness_(0), inlier_rmse_(0) {}
+    RANSACResult()
+        : fitness_(0),
+          inlier_rmse_(0),
+          iteration_(-1),
+          plane_model_(0, 0, 0, 0) {}
     ~RANSACResult() {}
 
+public:
+    /// Returns true if this result is better than \p other. Ties are broken
+    /// by the iteration index so that the result does not depend on the
+    /// order in which the hypotheses are scored.
+    bool IsBetterThan(const RANSACResult &other) const {
+        if (iteration_ < 0) return false;
+        if (other.iteration_ < 0) return true;
+        if (fitness_ != other.fitness_) return fitness_ > other.fitness_;
+        if (inlier_rmse_ != other.inlier_rmse_) {
+            return inlier_rmse_ < other.inlier_rmse_;
+        }
+        return iteration_ < other.iteration_;
+    }
+
 public:
     double fitness_;
     double inlier_rmse_;
+    int iteration_;
+    Eigen::Vector4d plane_model_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
+/// Number of hypotheses scored per parallel block. It is fixed so that the
+/// iterations run do not depend on the number of threads.
+static const int RANSAC_BLOCK_SIZE = 64;
+
+// Calculates the number of inliers given the points (one per column) and a
+// plane model, and the total distance between the inliers and the plane. These
+// numbers are then used to evaluate how well the plane model fits the given
+// points.
 RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        const Eigen::Ref<const Eigen::Matrix3Xd> &points,
+        const Eigen::Vector4d &plane_model,
+        double distance_threshold) {
     RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
-        }
-    }
-
-    size_t inlier_num = inliers.size();
+    Eigen::ArrayXd distance =
+            ((plane_model.head<3>().transpose() * points).array() +
+             plane_model(3))
+                    .abs()
+                    .transpose();
+    auto is_inlier = distance < distance_threshold;
+    size_t inlier_num = is_inlier.count();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
     } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+        double error = is_inlier.select(distance, 0.0).sum();
+        result.fitness_ = (double)inlier_num / (double)points.cols();
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
 }
 
+// Returns the number of RANSAC iterations needed to draw an all-inlier sample
+// with the given probability, see Hartley and Zisserman, Multiple View
+// Geometry, Section 4.7.1.
+int GetRANSACRequiredIterations(double inlier_ratio,
+                                int ransac_n,
+                                double probability,
+                                int max_iterations) {
+    if (inlier_ratio <= 0.0) return max_iterations;
+    double all_inlier = std::pow(inlier_ratio, ransac_n);
+    if (all_inlier >= 1.0 || probability <= 0.0) return 0;
+    if (probability >= 1.0) return max_iterations;
+    double iterations =
+            std::ceil(std::log(1.0 - probability) / std::log(1.0 - all_inlier));
+    return iterations < max_iterations ? int(iterations) : max_iterations;
+}
+
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
 // Reference:
 // https://www.ilikebigbits.com/2015_03_04_plane_from_points.html
-Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
-                                   const std::vector<size_t> &inliers) {
+Eigen::Vector4d GetPlaneFromPoints(
+        const Eigen::Ref<const Eigen::Matrix3Xd> &points,
+        const std::vector<size_t> &inliers) {
     Eigen::Vector3d centroid(0, 0, 0);
     for (size_t idx : inliers) {
-        centroid += points[idx];
+        centroid += points.col(idx);
     }
     centroid /= double(inliers.size());
 
     double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
 
     for (size_t idx : inliers) {
-        Eigen::Vector3d r = points[idx] - centroid;
+        Eigen::Vector3d r = points.col(idx) - centroid;
         xx += r(0) * r(0);
         xy += r(0) * r(1);
         xz += r(0) * r(2);
@@ -133,86 +170,165 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+// Runs RANSAC on the columns of points, an indexed subset of the point cloud.
+// Returns the refined plane and the inliers as indices into the subset.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const Eigen::Ref<const Eigen::Matrix3Xd> &points,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        const uint64_t seed) {
+    const int num_points = int(points.cols());
+    RANSACResult best;
+    int max_iterations = num_iterations;
+    for (int block_begin = 0; block_begin < max_iterations;
+         block_begin += RANSAC_BLOCK_SIZE) {
+        int block_size =
+                std::min(RANSAC_BLOCK_SIZE, max_iterations - block_begin);
+        // RANSACResult holds a fixed size vectorizable Eigen::Vector4d, so
+        // it needs an aligned allocator.
+        std::vector<RANSACResult, Eigen::aligned_allocator<RANSACResult>>
+                results(block_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < block_size; k++) {
+            // Draw ransac_n distinct points from the stream of this iteration.
+            utility::RandomStream rng(seed, uint64_t(block_begin + k));
+            std::vector<int> sample;
+            while ((int)sample.size() < ransac_n) {
+                int idx = rng.UniformInt(0, num_points - 1);
+                if (std::find(sample.begin(), sample.end(), idx) ==
+                    sample.end()) {
+                    sample.push_back(idx);
+                }
+            }
 
-    // Initialize consensus set.
+            // Fit model to num_model_parameters randomly selected points among
+            // the inliers.
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points.col(sample[0]), points.col(sample[1]),
+                    points.col(sample[2]));
+            if (plane_model.isZero(0)) {
+                continue;
+            }
+            results[k] = EvaluateRANSACBasedOnDistance(points, plane_model,
+                                                       distance_threshold);
+            results[k].iteration_ = block_begin + k;
+            results[k].plane_model_ = plane_model;
+        }
+        for (const auto &result : results) {
+            if (result.IsBetterThan(best)) best = result;
+        }
+        // Stop as soon as an all-inlier sample has been drawn with the
+        // requested probability.
+        max_iterations = std::max(
+                block_begin + block_size,
+                GetRANSACRequiredIterations(best.fitness_, ransac_n,
+                                            probability, num_iterations));
+    }
+    // Find the final inliers using the best plane model.
     std::vector<size_t> inliers;
+    Eigen::ArrayXd distance =
+            ((best.plane_model_.head<3>().transpose() * points).array() +
+             best.plane_model_(3))
+                    .abs()
+                    .transpose();
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (distance(idx) < distance_threshold) {
+            inliers.emplace_back(idx);
+        }
+    }
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+    // Improve the best plane model using the final inliers.
+    Eigen::Vector4d plane_model = GetPlaneFromPoints(points, inliers);
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    utility::LogDebug(
+            "RANSAC | Iterations: {:d}, Inliers: {:d}, Fitness: {:e}, RMSE: "
+            "{:e}",
+            max_iterations, inliers.size(), best.fitness_, best.inlier_rmse_);
+    return std::make_tuple(plane_model, inliers);
+}
 
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
     // Return if ransac_n is less than the required plane model parameters.
     if (ransac_n < 3) {
         utility::LogError(
                 "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
     }
-    if (num_points < size_t(ransac_n)) {
+    if (points_.size() < size_t(ransac_n)) {
         utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
     }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
-
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+    Eigen::Matrix3Xd points(3, points_.size());
+    for (size_t idx = 0; idx < points_.size(); ++idx) {
+        points.col(idx) = points_[idx];
+    }
+    return SegmentPlaneRANSAC(points, distance_threshold, ransac_n,
+                              num_iterations, probability,
+                              utility::RandomSeed());
+}
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
-        }
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int max_num_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const size_t min_num_inliers /* = 3 */,
+                          const double probability /* = 0.99999999 */) const {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
     }
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    const uint64_t seed = utility::RandomSeed();
 
-    // Find the final inliers using best_plane_model.
-    inliers.clear();
+    // The remaining points are kept packed in a matrix together with their
+    // indices, and compacted in place after each extraction.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(remaining.begin(), remaining.end(), 0);
+    Eigen::Matrix3Xd points(3, points_.size());
     for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
+        points.col(idx) = points_[idx];
+    }
 
-        if (distance < distance_threshold) {
-            inliers.emplace_back(idx);
+    while ((int)planes.size() < max_num_planes &&
+           remaining.size() >= std::max(size_t(ransac_n), min_num_inliers)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = SegmentPlaneRANSAC(
+                points.leftCols(remaining.size()), distance_threshold,
+                ransac_n, num_iterations, probability,
+                seed + uint64_t(planes.size()));
+        if (inliers.size() < min_num_inliers || plane_model.isZero(0)) {
+            break;
         }
-    }
 
-    // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+        std::vector<size_t> plane_inliers(inliers.size());
+        std::vector<bool> is_inlier(remaining.size(), false);
+        for (size_t i = 0; i < inliers.size(); i++) {
+            plane_inliers[i] = remaining[inliers[i]];
+            is_inlier[inliers[i]] = true;
+        }
+        planes.emplace_back(plane_model, plane_inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
-    return std::make_tuple(best_plane_model, inliers);
+        size_t num_remaining = 0;
+        for (size_t i = 0; i < remaining.size(); i++) {
+            if (is_inlier[i]) continue;
+            remaining[num_remaining] = remaining[i];
+            points.col(num_remaining) = points.col(i);
+            num_remaining++;
+        }
+        remaining.resize(num_remaining);
+    }
+    utility::LogDebug("RANSAC | Extracted {:d} planes, {:d} points remaining",
+                      planes.size(), remaining.size());
+    return planes;
 }
 
 }  // namespace geometry
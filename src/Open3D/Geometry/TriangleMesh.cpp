@@ -30,11 +30,12 @@
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/VertexAdjacency.h"
 
 #include <Eigen/Dense>
 #include <numeric>
 #include <queue>
-#include <random>
 #include <tuple>
 
 #ifdef _OPENMP
@@ -42,6 +43,7 @@
 #endif
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -139,21 +141,37 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
-    adjacency_list_.clear();
-    adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
-    }
+    VertexAdjacency adjacency;
+    adjacency.ComputeFromTriangles(vertices_.size(), triangles_);
+    adjacency_list_ = adjacency.ToAdjacencyList();
     return *this;
 }
 
+namespace {
+
+/// Returns the sorted, unique vertices to filter, or all vertices if
+/// \p vertex_indices is empty.
+std::vector<size_t> FilteredVertices(
+        size_t num_vertices, const std::vector<size_t> &vertex_indices) {
+    std::vector<char> filtered(num_vertices, vertex_indices.empty() ? 1 : 0);
+    for (size_t vidx : vertex_indices) {
+        if (vidx >= num_vertices) {
+            utility::LogError(
+                    "[Filter] Index {} out of range for {} vertices.", vidx,
+                    num_vertices);
+        }
+        filtered[vidx] = 1;
+    }
+    return utility::NonZeroIndices(filtered);
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
-        int number_of_iterations, double strength, FilterScope scope) const {
+        int number_of_iterations,
+        double strength,
+        FilterScope scope,
+        const std::vector<size_t> &vertex_indices) const {
     bool filter_vertex =
             scope == FilterScope::All || scope == FilterScope::Vertex;
     bool filter_normal =
@@ -163,26 +181,36 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
             (scope == FilterScope::All || scope == FilterScope::Color) &&
             HasVertexColors();
 
+    // The output and the previous values are swapped after each iteration,
+    // so both start from the input to keep the unfiltered values intact.
     std::vector<Eigen::Vector3d> prev_vertices = vertices_;
     std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    VertexAdjacency adjacency(*this);
+    std::vector<size_t> filtered_vertices =
+            FilteredVertices(vertices_.size(), vertex_indices);
+    int num_filtered = int(filtered_vertices.size());
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_filtered; ++i) {
+            size_t vidx = filtered_vertices[i];
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            const int *neighbors = adjacency.NeighborIndices(vidx);
+            size_t nb_size = adjacency.NumNeighbors(vidx);
+            for (size_t k = 0; k < nb_size; ++k) {
+                int nbidx = neighbors[k];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -194,7 +222,6 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -224,7 +251,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
-        int number_of_iterations, FilterScope scope) const {
+        int number_of_iterations,
+        FilterScope scope,
+        const std::vector<size_t> &vertex_indices) const {
     bool filter_vertex =
             scope == FilterScope::All || scope == FilterScope::Vertex;
     bool filter_normal =
@@ -239,21 +268,29 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    VertexAdjacency adjacency(*this);
+    std::vector<size_t> filtered_vertices =
+            FilteredVertices(vertices_.size(), vertex_indices);
+    int num_filtered = int(filtered_vertices.size());
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_filtered; ++i) {
+            size_t vidx = filtered_vertices[i];
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            const int *neighbors = adjacency.NeighborIndices(vidx);
+            size_t nb_size = adjacency.NumNeighbors(vidx);
+            for (size_t k = 0; k < nb_size; ++k) {
+                int nbidx = neighbors[k];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -265,7 +302,6 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -289,25 +325,62 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     return mesh;
 }
 
+std::vector<double> TriangleMesh::ComputeAdjacencyWeightsCot(
+        const VertexAdjacency &adjacency) const {
+    auto edge_weights = ComputeEdgeWeightsCot(GetEdgeToVerticesMap(),
+                                              /*min_weight=*/0);
+    std::vector<double> weights(adjacency.indices_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(adjacency.NumVertices()); ++vidx) {
+        for (size_t k = adjacency.offsets_[vidx];
+             k < adjacency.offsets_[vidx + 1]; ++k) {
+            auto weight = edge_weights.find(
+                    GetOrderedEdge(vidx, adjacency.indices_[k]));
+            // Degenerate triangles give infinite weights, which are dropped.
+            if (weight != edge_weights.end() &&
+                std::isfinite(weight->second)) {
+                weights[k] = weight->second;
+            }
+        }
+    }
+    return weights;
+}
+
 void TriangleMesh::FilterSmoothLaplacianHelper(
         std::shared_ptr<TriangleMesh> &mesh,
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const VertexAdjacency &adjacency,
+        const std::vector<double> &weights,
+        const std::vector<size_t> &filtered_vertices,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(filtered_vertices.size()); ++i) {
+        size_t vidx = filtered_vertices[i];
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
+        const int *neighbors = adjacency.NeighborIndices(vidx);
+        int nb_size = adjacency.NumNeighbors(vidx);
+        for (int k = 0; k < nb_size; ++k) {
+            int nbidx = neighbors[k];
+            double weight;
+            if (weights.empty()) {
+                auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
+                double dist = diff.norm();
+                weight = 1. / (dist + 1e-12);
+            } else {
+                weight = weights[adjacency.offsets_[vidx] + k];
+            }
             total_weight += weight;
 
             if (filter_vertex) {
@@ -321,6 +394,17 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
             }
         }
 
+        // Vertices without weighted neighbors keep their values.
+        if (total_weight <= 0) {
+            if (filter_vertex) mesh->vertices_[vidx] = prev_vertices[vidx];
+            if (filter_normal) {
+                mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx];
+            }
+            if (filter_color) {
+                mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx];
+            }
+            continue;
+        }
         if (filter_vertex) {
             mesh->vertices_[vidx] =
                     prev_vertices[vidx] +
@@ -340,7 +424,11 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
-        int number_of_iterations, double lambda, FilterScope scope) const {
+        int number_of_iterations,
+        double lambda,
+        FilterScope scope,
+        bool use_cotangent_weights,
+        const std::vector<size_t> &vertex_indices) const {
     bool filter_vertex =
             scope == FilterScope::All || scope == FilterScope::Vertex;
     bool filter_normal =
@@ -355,20 +443,24 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+    VertexAdjacency adjacency(*this);
+    std::vector<double> weights;
+    if (use_cotangent_weights) {
+        weights = ComputeAdjacencyWeightsCot(adjacency);
     }
+    std::vector<size_t> filtered_vertices =
+            FilteredVertices(vertices_.size(), vertex_indices);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency, weights,
+                                    filtered_vertices, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -382,7 +474,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         int number_of_iterations,
         double lambda,
         double mu,
-        FilterScope scope) const {
+        FilterScope scope,
+        bool use_cotangent_weights,
+        const std::vector<size_t> &vertex_indices) const {
     bool filter_vertex =
             scope == FilterScope::All || scope == FilterScope::Vertex;
     bool filter_normal =
@@ -397,26 +491,31 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
+    VertexAdjacency adjacency(*this);
+    std::vector<double> weights;
+    if (use_cotangent_weights) {
+        weights = ComputeAdjacencyWeightsCot(adjacency);
     }
+    std::vector<size_t> filtered_vertices =
+            FilteredVertices(vertices_.size(), vertex_indices);
+
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency, weights,
+                                    filtered_vertices, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency, weights,
+                                    filtered_vertices, mu, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -442,12 +541,8 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     // sample point cloud
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    if (seed == -1) {
-        std::random_device rd;
-        seed = rd();
-    }
-    std::mt19937 mt(seed);
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    uint64_t stream_seed =
+            seed == -1 ? utility::RandomSeed() : uint64_t(int64_t(seed));
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal || use_triangle_normal) {
@@ -459,17 +554,32 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        size_t n = size_t(std::round(triangle_areas[tidx] * number_of_points));
-        while (point_idx < n) {
-            double r1 = dist(mt);
-            double r2 = dist(mt);
+    // Triangle tidx gets the points between the rounded cdf values of the
+    // previous triangle and its own, and draws them from its own random
+    // stream, so the result does not depend on the number of threads.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        size_t begin =
+                tidx == 0 ? 0
+                          : size_t(std::round(triangle_areas[tidx - 1] *
+                                              number_of_points));
+        size_t end = std::min(
+                number_of_points,
+                size_t(std::round(triangle_areas[tidx] * number_of_points)));
+        if (begin >= end) {
+            continue;
+        }
+        utility::RandomStream random(stream_seed, uint64_t(tidx));
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (size_t point_idx = begin; point_idx < end; ++point_idx) {
+            double r1 = random.UniformDouble();
+            double r2 = random.UniformDouble();
             double a = (1 - std::sqrt(r1));
             double b = std::sqrt(r1) * (1 - r2);
             double c = std::sqrt(r1) * r2;
 
-            const Eigen::Vector3i &triangle = triangles_[tidx];
             pcd->points_[point_idx] = a * vertices_[triangle(0)] +
                                       b * vertices_[triangle(1)] +
                                       c * vertices_[triangle(2)];
@@ -486,8 +596,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
                                           b * vertex_colors_[triangle(1)] +
                                           c * vertex_colors_[triangle(2)];
             }
-
-            point_idx++;
         }
     }
 
@@ -514,6 +622,92 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformly(
                                      surface_area, use_triangle_normal, seed);
 }
 
+namespace {
+
+/// Computes the neighbors within \p radius of every point, excluding the
+/// point itself, in compressed sparse row form. The points are sorted into a
+/// uniform grid of cells at least \p radius wide, so the neighbors of a point
+/// lie in its own cell and the 26 cells around it.
+void ComputeRadiusNeighborsInGrid(const std::vector<Eigen::Vector3d> &points,
+                                  double radius,
+                                  std::vector<size_t> &offsets,
+                                  std::vector<int> &indices,
+                                  std::vector<double> &distance2) {
+    int num_points = int(points.size());
+    Eigen::Vector3d min_bound = points[0];
+    Eigen::Vector3d max_bound = points[0];
+    for (const Eigen::Vector3d &point : points) {
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    // 21 bits per axis of the cell key
+    double cell_size = std::max(
+            radius, (max_bound - min_bound).maxCoeff() / double(1 << 20));
+    if (!(cell_size > 0)) {
+        cell_size = 1.0;
+    }
+    auto CellKey = [&](const Eigen::Vector3d &point, int dx, int dy, int dz) {
+        Eigen::Vector3d cell =
+                ((point - min_bound) / cell_size).array().floor();
+        return (uint64_t(int64_t(cell(0)) + 1 + dx) << 42) |
+               (uint64_t(int64_t(cell(1)) + 1 + dy) << 21) |
+               uint64_t(int64_t(cell(2)) + 1 + dz);
+    };
+    std::vector<std::pair<uint64_t, int>> cells(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < num_points; ++pidx) {
+        cells[pidx] = std::make_pair(CellKey(points[pidx], 0, 0, 0), pidx);
+    }
+    utility::ParallelSort(cells);
+
+    // The first pass counts the neighbors, the second one stores them
+    double radius2 = radius * radius;
+    offsets.assign(num_points + 1, 0);
+    for (int pass = 0; pass < 2; ++pass) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pidx = 0; pidx < num_points; ++pidx) {
+            const Eigen::Vector3d &point = points[pidx];
+            size_t k = pass == 0 ? 0 : offsets[pidx];
+            for (int dx = -1; dx <= 1; ++dx) {
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dz = -1; dz <= 1; ++dz) {
+                        uint64_t key = CellKey(point, dx, dy, dz);
+                        auto it = std::lower_bound(
+                                cells.begin(), cells.end(),
+                                std::make_pair(key, -1));
+                        for (; it != cells.end() && it->first == key; ++it) {
+                            double d2 = (points[it->second] - point)
+                                                .squaredNorm();
+                            if (it->second == pidx || d2 > radius2) {
+                                continue;
+                            }
+                            if (pass == 1) {
+                                indices[k] = it->second;
+                                distance2[k] = d2;
+                            }
+                            k++;
+                        }
+                    }
+                }
+            }
+            if (pass == 0) {
+                offsets[pidx + 1] = k;
+            }
+        }
+        if (pass == 0) {
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            indices.resize(offsets.back());
+            distance2.resize(offsets.back());
+        }
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         size_t number_of_points,
         double init_factor /* = 5 */,
@@ -566,7 +760,12 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
 
     std::vector<double> weights(pcl->points_.size());
     std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
+    std::vector<size_t> offsets;
+    std::vector<int> neighbors;
+    // Squared distances to the neighbors, replaced by their weights below
+    std::vector<double> neighbor_weights;
+    ComputeRadiusNeighborsInGrid(pcl->points_, r_max, offsets, neighbors,
+                                 neighbor_weights);
 
     auto WeightFcn = [&](double d2) {
         double d = std::sqrt(d2);
@@ -576,24 +775,18 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
+    // init weights and priority queue
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < int(pcl->points_.size()); ++pidx) {
         double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
-                continue;
-            }
-            weight += WeightFcn(dists2[nbidx]);
+        for (size_t k = offsets[pidx]; k < offsets[pidx + 1]; ++k) {
+            neighbor_weights[k] = WeightFcn(neighbor_weights[k]);
+            weight += neighbor_weights[k];
         }
-
-        weights[pidx0] = weight;
-    };
-
-    // init weights and priority queue
+        weights[pidx] = weight;
+    }
     typedef std::tuple<int, double> QueueEntry;
     auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
         return std::get<1>(a) < std::get<1>(b);
@@ -602,7 +795,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                         decltype(WeightCmp)>
             queue(WeightCmp);
     for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
         queue.push(QueueEntry(int(pidx0), weights[pidx0]));
     };
 
@@ -623,12 +815,14 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         deleted[pidx] = true;
         current_number_of_points--;
 
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
+        // update weights, the weights are symmetric so the weight of the
+        // deleted sample is read from its own neighbor list
+        for (size_t k = offsets[pidx]; k < offsets[pidx + 1]; ++k) {
+            int nb = neighbors[k];
+            if (deleted[nb]) {
+                continue;
+            }
+            weights[nb] -= neighbor_weights[k];
             queue.push(QueueEntry(nb, weights[nb]));
         }
     }
@@ -660,6 +854,30 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     return pcl;
 }
 
+namespace {
+
+/// Rotates \p triangle so that its smallest vertex index comes first, keeping
+/// its orientation.
+std::tuple<int, int, int> RotateToMinIndex(const Eigen::Vector3i &triangle) {
+    // We first need to find the minimum index. Because triangle (0-1-2)
+    // and triangle (2-0-1) are the same.
+    if (triangle(0) <= triangle(1)) {
+        if (triangle(0) <= triangle(2)) {
+            return std::make_tuple(triangle(0), triangle(1), triangle(2));
+        } else {
+            return std::make_tuple(triangle(2), triangle(0), triangle(1));
+        }
+    } else {
+        if (triangle(1) <= triangle(2)) {
+            return std::make_tuple(triangle(1), triangle(2), triangle(0));
+        } else {
+            return std::make_tuple(triangle(2), triangle(0), triangle(1));
+        }
+    }
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
     typedef std::tuple<double, double, double> Coordinate3;
     std::unordered_map<Coordinate3, size_t,
@@ -717,26 +935,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
     size_t old_triangle_num = triangles_.size();
     size_t k = 0;
     for (size_t i = 0; i < old_triangle_num; i++) {
-        Index3 index;
-        // We first need to find the minimum index. Because triangle (0-1-2)
-        // and triangle (2-0-1) are the same.
-        if (triangles_[i](0) <= triangles_[i](1)) {
-            if (triangles_[i](0) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](0), triangles_[i](1),
-                                        triangles_[i](2));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        } else {
-            if (triangles_[i](1) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](1), triangles_[i](2),
-                                        triangles_[i](0));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        }
+        Index3 index = RotateToMinIndex(triangles_[i]);
         if (triangle_to_old_index.find(index) == triangle_to_old_index.end()) {
             triangle_to_old_index[index] = i;
             triangles_[k] = triangles_[i];
@@ -829,6 +1028,182 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
     return *this;
 }
 
+TriangleMesh &TriangleMesh::CleanMesh(bool remove_duplicated_vertices,
+                                      bool remove_degenerate_triangles,
+                                      bool remove_duplicated_triangles,
+                                      bool remove_unreferenced_vertices) {
+    bool has_adjacency_list = HasAdjacencyList();
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    bool has_tri_normal = HasTriangleNormals();
+    bool has_tri_uvs = HasTriangleUvs();
+    bool has_tri_material_ids = HasTriangleMaterialIds();
+    int old_vertex_num = int(vertices_.size());
+    int old_triangle_num = int(triangles_.size());
+
+    // First vertex with the same coordinates as each vertex. Sorting puts
+    // equal coordinates next to each other with the smallest index first.
+    std::vector<int> first_vertex(old_vertex_num);
+    std::iota(first_vertex.begin(), first_vertex.end(), 0);
+    if (remove_duplicated_vertices) {
+        // NaN coordinates never compare equal, so those vertices are never
+        // merged and are left out of the sort.
+        std::vector<char> comparable(old_vertex_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < old_vertex_num; ++vidx) {
+            comparable[vidx] = !vertices_[vidx].hasNaN();
+        }
+        std::vector<size_t> vertex_ids = utility::NonZeroIndices(comparable);
+        typedef std::tuple<double, double, double, int> VertexKey;
+        std::vector<VertexKey> keys(vertex_ids.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(vertex_ids.size()); ++i) {
+            const Eigen::Vector3d &vertex = vertices_[vertex_ids[i]];
+            keys[i] = std::make_tuple(vertex(0), vertex(1), vertex(2),
+                                      int(vertex_ids[i]));
+        }
+        utility::ParallelSort(keys);
+        for (size_t i = 1; i < keys.size(); ++i) {
+            if (std::get<0>(keys[i]) == std::get<0>(keys[i - 1]) &&
+                std::get<1>(keys[i]) == std::get<1>(keys[i - 1]) &&
+                std::get<2>(keys[i]) == std::get<2>(keys[i - 1])) {
+                first_vertex[std::get<3>(keys[i])] =
+                        first_vertex[std::get<3>(keys[i - 1])];
+            }
+        }
+    }
+
+    // Triangles are remapped to the first vertices before they are compared.
+    // Compaction preserves the order of the vertex indices, so this gives the
+    // same duplicates as comparing after compaction.
+    std::vector<Eigen::Vector3i> triangles(old_triangle_num);
+    std::vector<char> keep_triangle(old_triangle_num, 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < old_triangle_num; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        triangles[tidx] = Eigen::Vector3i(first_vertex[triangle(0)],
+                                          first_vertex[triangle(1)],
+                                          first_vertex[triangle(2)]);
+        if (remove_degenerate_triangles) {
+            const Eigen::Vector3i &remapped = triangles[tidx];
+            keep_triangle[tidx] = remapped(0) != remapped(1) &&
+                                  remapped(1) != remapped(2) &&
+                                  remapped(2) != remapped(0);
+        }
+    }
+    if (remove_duplicated_triangles) {
+        std::vector<size_t> triangle_ids =
+                utility::NonZeroIndices(keep_triangle);
+        typedef std::tuple<int, int, int, int> TriangleKey;
+        std::vector<TriangleKey> keys(triangle_ids.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(triangle_ids.size()); ++i) {
+            keys[i] = std::tuple_cat(
+                    RotateToMinIndex(triangles[triangle_ids[i]]),
+                    std::make_tuple(int(triangle_ids[i])));
+        }
+        utility::ParallelSort(keys);
+        for (size_t i = 1; i < keys.size(); ++i) {
+            if (std::get<0>(keys[i]) == std::get<0>(keys[i - 1]) &&
+                std::get<1>(keys[i]) == std::get<1>(keys[i - 1]) &&
+                std::get<2>(keys[i]) == std::get<2>(keys[i - 1])) {
+                keep_triangle[std::get<3>(keys[i])] = 0;
+            }
+        }
+    }
+
+    std::vector<char> keep_vertex(old_vertex_num, 0);
+    if (remove_unreferenced_vertices) {
+        for (int tidx = 0; tidx < old_triangle_num; ++tidx) {
+            if (keep_triangle[tidx]) {
+                keep_vertex[triangles[tidx](0)] = 1;
+                keep_vertex[triangles[tidx](1)] = 1;
+                keep_vertex[triangles[tidx](2)] = 1;
+            }
+        }
+    } else {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < old_vertex_num; ++vidx) {
+            keep_vertex[vidx] = first_vertex[vidx] == vidx;
+        }
+    }
+
+    std::vector<size_t> vertex_ids = utility::NonZeroIndices(keep_vertex);
+    int num_vertices = int(vertex_ids.size());
+    std::vector<int> new_vertex_id(old_vertex_num, -1);
+    std::vector<Eigen::Vector3d> vertices(num_vertices);
+    std::vector<Eigen::Vector3d> vertex_normals(has_vert_normal ? num_vertices
+                                                                : 0);
+    std::vector<Eigen::Vector3d> vertex_colors(has_vert_color ? num_vertices
+                                                              : 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_vertices; ++i) {
+        size_t vidx = vertex_ids[i];
+        new_vertex_id[vidx] = i;
+        vertices[i] = vertices_[vidx];
+        if (has_vert_normal) vertex_normals[i] = vertex_normals_[vidx];
+        if (has_vert_color) vertex_colors[i] = vertex_colors_[vidx];
+    }
+    vertices_.swap(vertices);
+    if (has_vert_normal) vertex_normals_.swap(vertex_normals);
+    if (has_vert_color) vertex_colors_.swap(vertex_colors);
+
+    std::vector<size_t> triangle_ids = utility::NonZeroIndices(keep_triangle);
+    int num_triangles = int(triangle_ids.size());
+    std::vector<Eigen::Vector3i> new_triangles(num_triangles);
+    std::vector<Eigen::Vector3d> triangle_normals(
+            has_tri_normal ? num_triangles : 0);
+    std::vector<Eigen::Vector2d> triangle_uvs(has_tri_uvs ? 3 * num_triangles
+                                                          : 0);
+    std::vector<int> triangle_material_ids(
+            has_tri_material_ids ? num_triangles : 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_triangles; ++i) {
+        size_t tidx = triangle_ids[i];
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        new_triangles[i] = Eigen::Vector3i(new_vertex_id[triangle(0)],
+                                           new_vertex_id[triangle(1)],
+                                           new_vertex_id[triangle(2)]);
+        if (has_tri_normal) triangle_normals[i] = triangle_normals_[tidx];
+        if (has_tri_uvs) {
+            for (int k = 0; k < 3; ++k) {
+                triangle_uvs[3 * i + k] = triangle_uvs_[3 * tidx + k];
+            }
+        }
+        if (has_tri_material_ids) {
+            triangle_material_ids[i] = triangle_material_ids_[tidx];
+        }
+    }
+    triangles_.swap(new_triangles);
+    if (has_tri_normal) triangle_normals_.swap(triangle_normals);
+    if (has_tri_uvs) triangle_uvs_.swap(triangle_uvs);
+    if (has_tri_material_ids) {
+        triangle_material_ids_.swap(triangle_material_ids);
+    }
+
+    if (has_adjacency_list) {
+        ComputeAdjacencyList();
+    }
+    utility::LogDebug(
+            "[CleanMesh] {:d} vertices and {:d} triangles have been removed.",
+            old_vertex_num - num_vertices, old_triangle_num - num_triangles);
+    return *this;
+}
+
 TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
     if (HasTriangleUvs()) {
         utility::LogWarning(
@@ -1314,34 +1689,7 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
-    return self_intersecting_triangles;
+    return TriangleMeshBVH(*this).ComputeSelfIntersections();
 }
 
 bool TriangleMesh::IsSelfIntersecting() const {
@@ -1357,22 +1705,19 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
+    // Build the hierarchy over the larger mesh and query the smaller one.
+    if (triangles_.size() >= other.triangles_.size()) {
+        return TriangleMeshBVH(*this).IsIntersecting(other);
     }
-    return false;
+    return TriangleMeshBVH(other).IsIntersecting(*this);
+}
+
+ClosestPointResult TriangleMesh::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &queries,
+        bool signed_distance,
+        double max_distance) const {
+    return TriangleMeshBVH(*this).ComputeClosestPoints(
+            queries, signed_distance, max_distance);
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -1544,6 +1889,52 @@ void TriangleMesh::RemoveVerticesByMask(const std::vector<bool> &vertex_mask) {
     RemoveTrianglesByMask(triangle_mask);
 }
 
+namespace {
+
+/// Returns the triangles whose three vertices are all in \p indices, and the
+/// vertices referenced by them, both as masks.
+std::tuple<std::vector<char>, std::vector<char>> SelectionMasks(
+        const TriangleMesh &mesh, const std::vector<size_t> &indices) {
+    std::vector<char> selected_vertex(mesh.vertices_.size(), 0);
+    for (size_t i : indices) {
+        if (i >= mesh.vertices_.size()) {
+            utility::LogError(
+                    "[SelectByIndex] Index {} out of range for {} vertices.",
+                    i, mesh.vertices_.size());
+        }
+        selected_vertex[i] = 1;
+    }
+    std::vector<char> keep_triangle(mesh.triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int t = 0; t < int(mesh.triangles_.size()); t++) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[t];
+        keep_triangle[t] = selected_vertex[triangle(0)] &&
+                           selected_vertex[triangle(1)] &&
+                           selected_vertex[triangle(2)];
+    }
+    std::vector<char> keep_vertex(mesh.vertices_.size(), 0);
+    for (size_t t = 0; t < mesh.triangles_.size(); t++) {
+        if (keep_triangle[t]) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[t];
+            keep_vertex[triangle(0)] = 1;
+            keep_vertex[triangle(1)] = 1;
+            keep_vertex[triangle(2)] = 1;
+        }
+    }
+    return std::make_tuple(keep_triangle, keep_vertex);
+}
+
+/// Merges duplicates and removes degenerate triangles after a selection.
+/// Degenerate triangles are removed last, so vertices that are only used by
+/// them are kept.
+void CleanSelection(TriangleMesh &mesh) {
+    mesh.CleanMesh(true, false, true, true).RemoveDegenerateTriangles();
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SelectByIndex(
         const std::vector<size_t> &indices) const {
     if (HasTriangleUvs()) {
@@ -1555,72 +1946,48 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SelectByIndex(
     bool has_triangle_normals = HasTriangleNormals();
     bool has_vertex_normals = HasVertexNormals();
     bool has_vertex_colors = HasVertexColors();
-    // For each vertex, list face indices.
-    std::vector<std::vector<int>> vertex_to_triangle_temp(vertices_.size());
-    int triangle_id = 0;
-    for (auto trangle : triangles_) {
-        for (int i = 0; i < 3; i++)
-            vertex_to_triangle_temp[trangle(i)].push_back(triangle_id);
-        triangle_id++;
-    }
-    // Remove face indices of vertex_to_triangle_temp
-    // if it does not correspond to selected vertices
-    std::vector<std::vector<int>> vertex_to_triangle(vertices_.size());
-    for (auto vertex_id : indices) {
-        vertex_to_triangle[vertex_id] = vertex_to_triangle_temp[vertex_id];
-    }
-    // Make a triangle_to_vertex using vertex_to_triangle
-    std::vector<std::vector<int>> triangle_to_vertex(triangles_.size());
-    int vertex_id = 0;
-    for (auto face_ids : vertex_to_triangle) {
-        for (auto face_id : face_ids)
-            triangle_to_vertex[face_id].push_back(vertex_id);
-        vertex_id++;
-    }
-    // Only a face with three selected points contributes to mark
-    // mask_observed_vertex.
-    std::vector<bool> mask_observed_vertex(vertices_.size());
-    for (auto vertex_ids : triangle_to_vertex) {
-        if ((int)vertex_ids.size() == 3)
-            for (int i = 0; i < 3; i++)
-                mask_observed_vertex[vertex_ids[i]] = true;
-    }
+
+    std::vector<char> keep_triangle, keep_vertex;
+    std::tie(keep_triangle, keep_vertex) = SelectionMasks(*this, indices);
+    std::vector<size_t> triangle_ids = utility::NonZeroIndices(keep_triangle);
+    std::vector<size_t> vertex_ids = utility::NonZeroIndices(keep_vertex);
+
     // Rename vertex id based on selected points
-    std::vector<int> new_vertex_id(vertices_.size());
-    for (size_t i = 0, cnt = 0; i < mask_observed_vertex.size(); i++) {
-        if (mask_observed_vertex[i]) {
-            new_vertex_id[i] = int(cnt);
-            cnt++;
-        }
-    }
-    // Push a triangle that has 3 selected vertices.
-    triangle_id = 0;
-    for (auto vertex_ids : triangle_to_vertex) {
-        if ((int)vertex_ids.size() == 3) {
-            Eigen::Vector3i new_face;
-            for (int i = 0; i < 3; i++)
-                new_face(i) = new_vertex_id[triangles_[triangle_id][i]];
-            output->triangles_.push_back(new_face);
-            if (has_triangle_normals)
-                output->triangle_normals_.push_back(
-                        triangle_normals_[triangle_id]);
-        }
-        triangle_id++;
-    }
-    // Push marked vertex.
-    for (size_t i = 0; i < mask_observed_vertex.size(); i++) {
-        if (mask_observed_vertex[i]) {
-            output->vertices_.push_back(vertices_[i]);
-            if (has_vertex_normals)
-                output->vertex_normals_.push_back(vertex_normals_[i]);
-            if (has_vertex_colors)
-                output->vertex_colors_.push_back(vertex_colors_[i]);
-        }
-    }
-    output->RemoveDuplicatedVertices();
-    output->RemoveDuplicatedTriangles();
-    output->RemoveUnreferencedVertices();
-    output->RemoveDegenerateTriangles();
+    std::vector<int> new_vertex_id(vertices_.size(), -1);
+    int num_vertices = int(vertex_ids.size());
+    output->vertices_.resize(num_vertices);
+    if (has_vertex_normals) output->vertex_normals_.resize(num_vertices);
+    if (has_vertex_colors) output->vertex_colors_.resize(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_vertices; i++) {
+        size_t vidx = vertex_ids[i];
+        new_vertex_id[vidx] = i;
+        output->vertices_[i] = vertices_[vidx];
+        if (has_vertex_normals) {
+            output->vertex_normals_[i] = vertex_normals_[vidx];
+        }
+        if (has_vertex_colors) {
+            output->vertex_colors_[i] = vertex_colors_[vidx];
+        }
+    }
+    int num_triangles = int(triangle_ids.size());
+    output->triangles_.resize(num_triangles);
+    if (has_triangle_normals) output->triangle_normals_.resize(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_triangles; i++) {
+        const Eigen::Vector3i &triangle = triangles_[triangle_ids[i]];
+        output->triangles_[i] = Eigen::Vector3i(new_vertex_id[triangle(0)],
+                                                new_vertex_id[triangle(1)],
+                                                new_vertex_id[triangle(2)]);
+        if (has_triangle_normals) {
+            output->triangle_normals_[i] = triangle_normals_[triangle_ids[i]];
+        }
+    }
+    CleanSelection(*output);
     utility::LogDebug(
             "Triangle mesh sampled from {:d} vertices and {:d} triangles to "
             "{:d} vertices and {:d} triangles.",
@@ -1629,6 +1996,67 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SelectByIndex(
     return output;
 }
 
+TriangleMesh &TriangleMesh::SelectByIndexInPlace(
+        const std::vector<size_t> &indices) {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SelectByIndices] This mesh contains triangle uvs that are "
+                "not handled in this function");
+        triangle_uvs_.clear();
+    }
+    bool has_triangle_normals = HasTriangleNormals();
+    bool has_vertex_normals = HasVertexNormals();
+    bool has_vertex_colors = HasVertexColors();
+    bool has_adjacency_list = HasAdjacencyList();
+    size_t old_vertex_num = vertices_.size();
+    size_t old_triangle_num = triangles_.size();
+
+    std::vector<char> keep_triangle, keep_vertex;
+    std::tie(keep_triangle, keep_vertex) = SelectionMasks(*this, indices);
+
+    // Selected elements only move towards the front, so both arrays are
+    // compacted in a single forward pass.
+    std::vector<int> new_vertex_id(old_vertex_num, -1);
+    size_t k = 0;
+    for (size_t i = 0; i < old_vertex_num; i++) {
+        if (keep_vertex[i]) {
+            vertices_[k] = vertices_[i];
+            if (has_vertex_normals) vertex_normals_[k] = vertex_normals_[i];
+            if (has_vertex_colors) vertex_colors_[k] = vertex_colors_[i];
+            new_vertex_id[i] = int(k);
+            k++;
+        }
+    }
+    vertices_.resize(k);
+    if (has_vertex_normals) vertex_normals_.resize(k);
+    if (has_vertex_colors) vertex_colors_.resize(k);
+    k = 0;
+    for (size_t i = 0; i < old_triangle_num; i++) {
+        if (keep_triangle[i]) {
+            const Eigen::Vector3i &triangle = triangles_[i];
+            triangles_[k] = Eigen::Vector3i(new_vertex_id[triangle(0)],
+                                            new_vertex_id[triangle(1)],
+                                            new_vertex_id[triangle(2)]);
+            if (has_triangle_normals) {
+                triangle_normals_[k] = triangle_normals_[i];
+            }
+            k++;
+        }
+    }
+    triangles_.resize(k);
+    if (has_triangle_normals) triangle_normals_.resize(k);
+    CleanSelection(*this);
+    if (has_adjacency_list) {
+        ComputeAdjacencyList();
+    }
+    utility::LogDebug(
+            "Triangle mesh sampled from {:d} vertices and {:d} triangles to "
+            "{:d} vertices and {:d} triangles.",
+            (int)old_vertex_num, (int)old_triangle_num, (int)vertices_.size(),
+            (int)triangles_.size());
+    return *this;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::Crop(
         const AxisAlignedBoundingBox &bbox) const {
     if (bbox.IsEmpty()) {
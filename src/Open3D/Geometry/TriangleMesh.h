@@ -36,6 +36,8 @@
 
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/MeshBase.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/VertexAdjacency.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
@@ -152,6 +154,30 @@ public:
     /// They are usually the product of removing duplicated vertices.
     TriangleMesh &RemoveDegenerateTriangles();
 
+    /// \brief Function that removes duplicated vertices, degenerate
+    /// triangles, duplicated triangles and unreferenced vertices in a single
+    /// parallel pass.
+    ///
+    /// The enabled steps give the same mesh as calling
+    /// RemoveDuplicatedVertices, RemoveDegenerateTriangles,
+    /// RemoveDuplicatedTriangles and RemoveUnreferencedVertices in this order,
+    /// but duplicates are found by sorting, the mesh is compacted once and the
+    /// adjacency list is rebuilt at most once. Triangle uvs and material ids
+    /// are compacted along with the triangles.
+    ///
+    /// \param remove_duplicated_vertices Merge vertices with identical
+    /// coordinates.
+    /// \param remove_degenerate_triangles Remove triangles that reference a
+    /// vertex more than once.
+    /// \param remove_duplicated_triangles Remove triangles that reference the
+    /// same three vertices as an earlier triangle with the same orientation.
+    /// \param remove_unreferenced_vertices Remove vertices that are not
+    /// referenced by any remaining triangle.
+    TriangleMesh &CleanMesh(bool remove_duplicated_vertices = true,
+                            bool remove_degenerate_triangles = true,
+                            bool remove_duplicated_triangles = true,
+                            bool remove_unreferenced_vertices = true);
+
     /// \brief Function that removes all non-manifold edges, by successively
     /// deleting triangles with the smallest surface area adjacent to the
     /// non-manifold edge until the number of adjacent triangles to the edge is
@@ -175,10 +201,13 @@ public:
     /// \param number_of_iterations defines the number of repetitions
     /// of this operation.
     /// \param strength - The strength of the filter.
+    /// \param vertex_indices Vertices to filter, all vertices if empty. The
+    /// other vertices keep their values.
     std::shared_ptr<TriangleMesh> FilterSharpen(
             int number_of_iterations,
             double strength,
-            FilterScope scope = FilterScope::All) const;
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = {}) const;
 
     /// \brief Function to smooth triangle mesh with simple neighbour average.
     ///
@@ -188,9 +217,12 @@ public:
     ///
     /// \param number_of_iterations defines the number of repetitions
     /// of this operation.
+    /// \param vertex_indices Vertices to filter, all vertices if empty. The
+    /// other vertices keep their values.
     std::shared_ptr<TriangleMesh> FilterSmoothSimple(
             int number_of_iterations,
-            FilterScope scope = FilterScope::All) const;
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = {}) const;
 
     /// \brief Function to smooth triangle mesh using Laplacian.
     ///
@@ -198,14 +230,22 @@ public:
     /// with $v_i$ being the input value, $v_o$ the output value, $N$ is the
     /// set of adjacent neighbours, $w_n$ is the weighting of the neighbour
     /// based on the inverse distance (closer neighbours have higher weight),
+    /// or on the cotangent weights of the input mesh.
     ///
     /// \param number_of_iterations defines the number of repetitions
     /// of this operation.
     /// \param lambda is the smoothing parameter.
+    /// \param use_cotangent_weights Weight the neighbours by the cotangent
+    /// weights of the input mesh, clamped to be non-negative and computed
+    /// once for all iterations, instead of by inverse distance.
+    /// \param vertex_indices Vertices to filter, all vertices if empty. The
+    /// other vertices keep their values.
     std::shared_ptr<TriangleMesh> FilterSmoothLaplacian(
             int number_of_iterations,
             double lambda,
-            FilterScope scope = FilterScope::All) const;
+            FilterScope scope = FilterScope::All,
+            bool use_cotangent_weights = false,
+            const std::vector<size_t> &vertex_indices = {}) const;
 
     /// \brief Function to smooth triangle mesh using method of Taubin,
     /// "Curve and Surface Smoothing Without Shrinkage", 1995.
@@ -217,11 +257,17 @@ public:
     /// of this operation.
     /// \param lambda is the filter parameter
     /// \param mu is the filter parameter
+    /// \param use_cotangent_weights Weight the neighbours by the cotangent
+    /// weights of the input mesh instead of by inverse distance.
+    /// \param vertex_indices Vertices to filter, all vertices if empty. The
+    /// other vertices keep their values.
     std::shared_ptr<TriangleMesh> FilterSmoothTaubin(
             int number_of_iterations,
             double lambda = 0.5,
             double mu = -0.53,
-            FilterScope scope = FilterScope::All) const;
+            FilterScope scope = FilterScope::All,
+            bool use_cotangent_weights = false,
+            const std::vector<size_t> &vertex_indices = {}) const;
 
     /// Function that computes the Euler-Poincaré characteristic, i.e.,
     /// V + F - E, where V is the number of vertices, F is the number
@@ -251,7 +297,7 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Candidate pairs are found with a TriangleMeshBVH.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
@@ -263,9 +309,29 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. A TriangleMeshBVH is built over the larger mesh, and each
+    /// triangle of the smaller mesh is tested against the triangles with an
+    /// overlapping bounding box.
     bool IsIntersecting(const TriangleMesh &other) const;
 
+    /// \brief Function that computes the closest points on the mesh, and
+    /// their (signed) distances, for a batch of query points.
+    ///
+    /// Builds a TriangleMeshBVH for this call only. To query the same mesh
+    /// repeatedly, build a TriangleMeshBVH once and call
+    /// TriangleMeshBVH::ComputeClosestPoints() instead.
+    ///
+    /// \param queries The query points.
+    /// \param signed_distance If true, distances of queries inside the mesh
+    /// are negative. Requires a closed, consistently oriented mesh.
+    /// \param max_distance Queries further away than this from every
+    /// triangle get an infinite distance and triangle index -1.
+    ClosestPointResult ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &queries,
+            bool signed_distance = false,
+            double max_distance = std::numeric_limits<double>::infinity())
+            const;
+
     /// Function that tests if the given triangle mesh is orientable, i.e.
     /// the triangles can oriented in such a way that all normals point
     /// towards the outside.
@@ -358,6 +424,8 @@ public:
     /// normals. The triangle normals will be computed and added to the mesh
     /// if necessary. \param seed Sets the seed value used in the random
     /// generator, set to -1 to use a random seed value with each function call.
+    /// Each triangle draws its points from its own random stream, so the
+    /// result only depends on the seed and not on the number of threads.
     std::shared_ptr<PointCloud> SamplePointsUniformly(
             size_t number_of_points,
             bool use_triangle_normal = false,
@@ -365,10 +433,12 @@ public:
 
     /// Function to sample \param number_of_points points (blue noise).
     /// Based on the method presented in Yuksel, "Sample Elimination for
-    /// Generating Poisson Disk Sample Sets", EUROGRAPHICS, 2015 The PointCloud
-    /// \param pcl_init is used for sample elimination if given, otherwise a
-    /// PointCloud is first uniformly sampled with \param init_number_of_points
-    /// x \param number_of_points number of points.
+    /// Generating Poisson Disk Sample Sets", EUROGRAPHICS, 2015. The
+    /// neighborhoods of the samples are found once in a uniform grid.
+    /// The PointCloud \param pcl_init is used for sample elimination if
+    /// given, otherwise a PointCloud is first uniformly sampled with
+    /// \param init_number_of_points x \param number_of_points number of
+    /// points.
     /// \param use_triangle_normal Set to true to assign the triangle
     /// normals to the returned points instead of the interpolated vertex
     /// normals. The triangle normals will be computed and added to the mesh
@@ -412,8 +482,17 @@ public:
     /// \param target_number_of_triangles defines the number of triangles that
     /// the simplified mesh should have. It is not guranteed that this number
     /// will be reached.
+    /// \param use_independent_sets If true, collapses rounds of independent
+    /// edges in parallel instead of one edge at a time. The candidates of a
+    /// round are the edges with a cost at most the lower quartile of all edge
+    /// costs, and a candidate is collapsed if its random key is smaller than
+    /// the keys of all candidates touching the one-rings of its vertices.
+    /// Every round passes over the whole mesh, so on a single thread this is
+    /// about 2.5 times slower than collapsing one edge at a time; it is meant
+    /// for many threads.
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
-            int target_number_of_triangles) const;
+            int target_number_of_triangles,
+            bool use_independent_sets = false) const;
 
     /// Function to select points from \param input TriangleMesh into
     /// output TriangleMesh
@@ -422,6 +501,12 @@ public:
     std::shared_ptr<TriangleMesh> SelectByIndex(
             const std::vector<size_t> &indices) const;
 
+    /// Function to select vertices of this TriangleMesh in place. Same as
+    /// SelectByIndex(), but the selected vertices and triangles are compacted
+    /// within the existing buffers.
+    /// \param indices defines Indices of vertices to be selected.
+    TriangleMesh &SelectByIndexInPlace(const std::vector<size_t> &indices);
+
     /// Function to crop pointcloud into output pointcloud
     /// All points with coordinates outside the bounding box \param bbox are
     /// clipped.
@@ -698,7 +783,9 @@ protected:
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const VertexAdjacency &adjacency,
+            const std::vector<double> &weights,
+            const std::vector<size_t> &filtered_vertices,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -722,6 +809,13 @@ protected:
                     &edges_to_vertices,
             double min_weight = std::numeric_limits<double>::lowest()) const;
 
+    /// \brief Function that computes the non-negative cot weight of every
+    /// entry of \p adjacency, in the layout of adjacency.indices_.
+    ///
+    /// \param adjacency Vertex adjacency of this mesh.
+    std::vector<double> ComputeAdjacencyWeightsCot(
+            const VertexAdjacency &adjacency) const;
+
 public:
     /// List of triangles denoted by the index of points forming the triangle.
     std::vector<Eigen::Vector3i> triangles_;
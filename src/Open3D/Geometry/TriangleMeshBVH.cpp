@@ -0,0 +1,653 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Upper bound of the traversal stack. The depth of the hierarchy is bounded
+/// by the number of bits of the Morton code plus the tie-breaking index.
+constexpr int kMaxStackSize = 256;
+
+/// Spreads the lower 21 bits of \p value so that there are two zero bits
+/// between consecutive bits.
+uint64_t ExpandBits(uint64_t value) {
+    uint64_t x = value & 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+int CountLeadingZeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return value == 0 ? 64 : __builtin_clzll(value);
+#else
+    int count = 0;
+    for (uint64_t bit = uint64_t(1) << 63; bit != 0 && !(value & bit);
+         bit >>= 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+/// Length of the common prefix of the sorted keys \p i and \p j, where equal
+/// Morton codes are told apart by their position. Returns -1 if \p j is out of
+/// range.
+int CommonPrefix(const std::vector<std::pair<uint64_t, int>> &keys,
+                 int i,
+                 int j) {
+    if (j < 0 || j >= int(keys.size())) {
+        return -1;
+    }
+    if (keys[i].first == keys[j].first) {
+        return 64 + CountLeadingZeros(uint64_t(i ^ j));
+    }
+    return CountLeadingZeros(keys[i].first ^ keys[j].first);
+}
+
+/// Squared distance from \p point to the box from \p min_bound to
+/// \p max_bound, zero inside the box.
+double BoxDistance2(const Eigen::Vector3d &point,
+                    const Eigen::Vector3d &min_bound,
+                    const Eigen::Vector3d &max_bound) {
+    Eigen::Vector3d d = (min_bound - point)
+                                .cwiseMax(point - max_bound)
+                                .cwiseMax(Eigen::Vector3d::Zero());
+    return d.squaredNorm();
+}
+
+/// Ray parameter at which the ray enters the box, clamped to zero, or a
+/// negative value if the ray misses the box before \p max_t. Along axes where
+/// the direction is zero (infinite \p inv_direction) the slab is unbounded if
+/// the origin lies in it, boundaries included, and missed otherwise.
+double RayBoxEntry(const Eigen::Vector3d &origin,
+                   const Eigen::Vector3d &inv_direction,
+                   const Eigen::Vector3d &min_bound,
+                   const Eigen::Vector3d &max_bound,
+                   double max_t) {
+    double t_near = 0;
+    double t_far = max_t;
+    for (int i = 0; i < 3; i++) {
+        if (std::isinf(inv_direction(i))) {
+            if (origin(i) < min_bound(i) || origin(i) > max_bound(i)) {
+                return -1;
+            }
+            continue;
+        }
+        double t0 = (min_bound(i) - origin(i)) * inv_direction(i);
+        double t1 = (max_bound(i) - origin(i)) * inv_direction(i);
+        t_near = std::max(t_near, std::min(t0, t1));
+        t_far = std::min(t_far, std::max(t0, t1));
+    }
+    return t_near <= t_far ? t_near : -1;
+}
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh) {
+    SetTriangleMesh(mesh);
+}
+
+bool TriangleMeshBVH::SetTriangleMesh(const TriangleMesh &mesh) {
+    Clear();
+    vertices_ = mesh.vertices_;
+    triangles_ = mesh.triangles_;
+    int num_triangles = int(triangles_.size());
+    if (num_triangles == 0) {
+        return true;
+    }
+    int num_internal = num_triangles - 1;
+
+    // Morton codes of the triangle centroids, quantized within their bounds.
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        centroids[tidx] = (vertices_[triangle(0)] + vertices_[triangle(1)] +
+                           vertices_[triangle(2)]) /
+                          3.0;
+    }
+    Eigen::Vector3d min_bound = centroids[0];
+    Eigen::Vector3d max_bound = centroids[0];
+    for (const auto &centroid : centroids) {
+        min_bound = min_bound.cwiseMin(centroid);
+        max_bound = max_bound.cwiseMax(centroid);
+    }
+    const double max_cell = double((1 << 21) - 1);
+    Eigen::Vector3d scale;
+    for (int axis = 0; axis < 3; axis++) {
+        double extent = max_bound(axis) - min_bound(axis);
+        scale(axis) = extent > 0 ? max_cell / extent : 0;
+    }
+    std::vector<std::pair<uint64_t, int>> keys(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        Eigen::Vector3d cell =
+                (centroids[tidx] - min_bound).cwiseProduct(scale);
+        uint64_t code = (ExpandBits(uint64_t(cell(0))) << 2) |
+                        (ExpandBits(uint64_t(cell(1))) << 1) |
+                        ExpandBits(uint64_t(cell(2)));
+        keys[tidx] = std::make_pair(code, tidx);
+    }
+    utility::ParallelSort(keys);
+
+    nodes_.resize(num_internal + num_triangles);
+    leaf_triangles_.resize(num_triangles);
+    std::vector<int> parents(nodes_.size(), -1);
+    auto LeafNode = [&](int k) { return num_internal + k; };
+
+    // Every internal node covers a range of sorted keys, which is found from
+    // the common prefixes with its neighbors alone.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_internal; i++) {
+        int d = CommonPrefix(keys, i, i + 1) > CommonPrefix(keys, i, i - 1)
+                        ? 1
+                        : -1;
+        int prefix_min = CommonPrefix(keys, i, i - d);
+        int length_max = 2;
+        while (CommonPrefix(keys, i, i + length_max * d) > prefix_min) {
+            length_max *= 2;
+        }
+        int length = 0;
+        for (int t = length_max / 2; t >= 1; t /= 2) {
+            if (CommonPrefix(keys, i, i + (length + t) * d) > prefix_min) {
+                length += t;
+            }
+        }
+        int j = i + length * d;
+        int prefix_node = CommonPrefix(keys, i, j);
+        int split = 0;
+        int t = length;
+        do {
+            t = (t + 1) / 2;
+            if (CommonPrefix(keys, i, i + (split + t) * d) > prefix_node) {
+                split += t;
+            }
+        } while (t > 1);
+        int gamma = i + split * d + std::min(d, 0);
+        int left = std::min(i, j) == gamma ? LeafNode(gamma) : gamma;
+        int right =
+                std::max(i, j) == gamma + 1 ? LeafNode(gamma + 1) : gamma + 1;
+        nodes_[i].left_ = left;
+        nodes_[i].right_ = right;
+        parents[left] = i;
+        parents[right] = i;
+    }
+
+    // Bounding boxes from the leaves up. The second child to arrive at a node
+    // computes its box, so every node is processed exactly once.
+    std::unique_ptr<std::atomic<int>[]> arrivals(
+            new std::atomic<int>[std::max(num_internal, 1)]);
+    for (int i = 0; i < num_internal; i++) {
+        arrivals[i] = 0;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < num_triangles; k++) {
+        int tidx = keys[k].second;
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        Node &leaf = nodes_[LeafNode(k)];
+        leaf.min_bound_ = vertices_[triangle(0)]
+                                  .cwiseMin(vertices_[triangle(1)])
+                                  .cwiseMin(vertices_[triangle(2)]);
+        leaf.max_bound_ = vertices_[triangle(0)]
+                                  .cwiseMax(vertices_[triangle(1)])
+                                  .cwiseMax(vertices_[triangle(2)]);
+        leaf.left_ = -1;
+        leaf.right_ = -1;
+        leaf_triangles_[k] = tidx;
+        int node = parents[LeafNode(k)];
+        while (node >= 0 && arrivals[node].fetch_add(1) == 1) {
+            Node &parent = nodes_[node];
+            const Node &left = nodes_[parent.left_];
+            const Node &right = nodes_[parent.right_];
+            parent.min_bound_ = left.min_bound_.cwiseMin(right.min_bound_);
+            parent.max_bound_ = left.max_bound_.cwiseMax(right.max_bound_);
+            node = parents[node];
+        }
+    }
+    ComputePseudonormals();
+    return true;
+}
+
+void TriangleMeshBVH::ComputePseudonormals() {
+    int num_triangles = int(triangles_.size());
+    triangle_normals_.resize(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        Eigen::Vector3d normal =
+                (vertices_[triangle(1)] - vertices_[triangle(0)])
+                        .cross(vertices_[triangle(2)] - vertices_[triangle(0)]);
+        double norm = normal.norm();
+        triangle_normals_[tidx] = norm > 0 ? Eigen::Vector3d(normal / norm)
+                                           : Eigen::Vector3d::Zero();
+    }
+
+    // Vertices sum the normals of their triangles weighted by the incident
+    // angle.
+    vertex_pseudonormals_.assign(vertices_.size(), Eigen::Vector3d::Zero());
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (int k = 0; k < 3; k++) {
+            const Eigen::Vector3d &v = vertices_[triangle(k)];
+            Eigen::Vector3d e1 = vertices_[triangle((k + 1) % 3)] - v;
+            Eigen::Vector3d e2 = vertices_[triangle((k + 2) % 3)] - v;
+            double angle = std::atan2(e1.cross(e2).norm(), e1.dot(e2));
+            vertex_pseudonormals_[triangle(k)] +=
+                    angle * triangle_normals_[tidx];
+        }
+    }
+
+    // Edges sum the normals of their triangles. Sorting the edges by their
+    // vertices brings the copies of an edge together.
+    std::vector<std::pair<uint64_t, int>> edges(3 * size_t(num_triangles));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (int k = 0; k < 3; k++) {
+            uint64_t v0 = uint32_t(triangle(k));
+            uint64_t v1 = uint32_t(triangle((k + 1) % 3));
+            edges[3 * tidx + k] =
+                    std::make_pair(std::min(v0, v1) << 32 | std::max(v0, v1),
+                                   3 * tidx + k);
+        }
+    }
+    utility::ParallelSort(edges);
+    edge_pseudonormals_.resize(edges.size());
+    for (size_t begin = 0, end = 0; begin < edges.size(); begin = end) {
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        for (end = begin;
+             end < edges.size() && edges[end].first == edges[begin].first;
+             end++) {
+            normal += triangle_normals_[edges[end].second / 3];
+        }
+        for (size_t i = begin; i < end; i++) {
+            edge_pseudonormals_[edges[i].second] = normal;
+        }
+    }
+}
+
+void TriangleMeshBVH::Clear() {
+    vertices_.clear();
+    triangles_.clear();
+    nodes_.clear();
+    leaf_triangles_.clear();
+    vertex_pseudonormals_.clear();
+    edge_pseudonormals_.clear();
+    triangle_normals_.clear();
+}
+
+template <typename EnterNode, typename VisitTriangle>
+void TriangleMeshBVH::Traverse(const EnterNode &enter,
+                               const VisitTriangle &visit) const {
+    if (nodes_.empty()) {
+        return;
+    }
+    int stack[kMaxStackSize];
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0) {
+        int node = stack[--stack_size];
+        if (!enter(nodes_[node])) {
+            continue;
+        }
+        if (IsLeaf(node)) {
+            if (!visit(LeafTriangle(node))) {
+                return;
+            }
+        } else {
+            stack[stack_size++] = nodes_[node].right_;
+            stack[stack_size++] = nodes_[node].left_;
+        }
+    }
+}
+
+std::vector<int> TriangleMeshBVH::QueryBoundingBox(
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound) const {
+    std::vector<int> indices;
+    Traverse(
+            [&](const Node &node) {
+                return IntersectionTest::AABBAABB(min_bound, max_bound,
+                                                  node.min_bound_,
+                                                  node.max_bound_);
+            },
+            [&](int tidx) {
+                indices.push_back(tidx);
+                return true;
+            });
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+int TriangleMeshBVH::CastRay(const Eigen::Vector3d &origin,
+                             const Eigen::Vector3d &direction,
+                             double &t,
+                             double max_t) const {
+    int hit = -1;
+    t = max_t;
+    if (nodes_.empty()) {
+        return hit;
+    }
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    // Children are visited nearest first, and subtrees entered beyond the
+    // closest hit so far are skipped.
+    int stack[kMaxStackSize];
+    double stack_entry[kMaxStackSize];
+    int stack_size = 0;
+    double root_entry = RayBoxEntry(origin, inv_direction,
+                                    nodes_[0].min_bound_,
+                                    nodes_[0].max_bound_, t);
+    if (root_entry >= 0) {
+        stack[stack_size] = 0;
+        stack_entry[stack_size++] = root_entry;
+    }
+    while (stack_size > 0) {
+        stack_size--;
+        int node = stack[stack_size];
+        if (stack_entry[stack_size] > t) {
+            continue;
+        }
+        if (IsLeaf(node)) {
+            int tidx = LeafTriangle(node);
+            const Eigen::Vector3i &triangle = triangles_[tidx];
+            double t_hit = IntersectionTest::RayTriangle(
+                    origin, direction, vertices_[triangle(0)],
+                    vertices_[triangle(1)], vertices_[triangle(2)]);
+            if (t_hit >= 0 && (t_hit < t || (t_hit == t && tidx < hit))) {
+                t = t_hit;
+                hit = tidx;
+            }
+            continue;
+        }
+        int children[2] = {nodes_[node].left_, nodes_[node].right_};
+        double entries[2];
+        for (int c = 0; c < 2; c++) {
+            const Node &child = nodes_[children[c]];
+            entries[c] = RayBoxEntry(origin, inv_direction, child.min_bound_,
+                                     child.max_bound_, t);
+        }
+        int near = 0;
+        if (entries[1] >= 0 && (entries[0] < 0 || entries[1] < entries[0])) {
+            near = 1;
+        }
+        for (int c : {1 - near, near}) {
+            if (entries[c] >= 0) {
+                stack[stack_size] = children[c];
+                stack_entry[stack_size++] = entries[c];
+            }
+        }
+    }
+    if (hit < 0) {
+        t = std::numeric_limits<double>::infinity();
+    }
+    return hit;
+}
+
+int TriangleMeshBVH::ComputeClosestPoint(const Eigen::Vector3d &query,
+                                         Eigen::Vector3d &closest_point,
+                                         double &distance2,
+                                         double max_distance) const {
+    int closest = -1;
+    distance2 = max_distance * max_distance;
+    if (nodes_.empty()) {
+        return closest;
+    }
+    // Same ordered traversal as CastRay(), with the distance to the boxes.
+    int stack[kMaxStackSize];
+    double stack_distance2[kMaxStackSize];
+    int stack_size = 0;
+    stack[stack_size] = 0;
+    stack_distance2[stack_size++] =
+            BoxDistance2(query, nodes_[0].min_bound_, nodes_[0].max_bound_);
+    while (stack_size > 0) {
+        stack_size--;
+        int node = stack[stack_size];
+        if (stack_distance2[stack_size] > distance2) {
+            continue;
+        }
+        if (IsLeaf(node)) {
+            int tidx = LeafTriangle(node);
+            const Eigen::Vector3i &triangle = triangles_[tidx];
+            Eigen::Vector3d point = IntersectionTest::PointTriangleClosestPoint(
+                    query, vertices_[triangle(0)], vertices_[triangle(1)],
+                    vertices_[triangle(2)]);
+            double d2 = (point - query).squaredNorm();
+            if (d2 < distance2 ||
+                (d2 == distance2 && (closest < 0 || tidx < closest))) {
+                distance2 = d2;
+                closest_point = point;
+                closest = tidx;
+            }
+            continue;
+        }
+        int children[2] = {nodes_[node].left_, nodes_[node].right_};
+        double child_distance2[2];
+        for (int c = 0; c < 2; c++) {
+            const Node &child = nodes_[children[c]];
+            child_distance2[c] =
+                    BoxDistance2(query, child.min_bound_, child.max_bound_);
+        }
+        int near = child_distance2[1] < child_distance2[0] ? 1 : 0;
+        for (int c : {1 - near, near}) {
+            if (child_distance2[c] <= distance2) {
+                stack[stack_size] = children[c];
+                stack_distance2[stack_size++] = child_distance2[c];
+            }
+        }
+    }
+    if (closest < 0) {
+        distance2 = std::numeric_limits<double>::infinity();
+    }
+    return closest;
+}
+
+ClosestPointResult TriangleMeshBVH::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &queries,
+        bool signed_distance,
+        double max_distance) const {
+    ClosestPointResult result;
+    result.distances_.resize(queries.size());
+    result.points_.resize(queries.size());
+    result.triangle_indices_.resize(queries.size());
+    result.barycentric_coordinates_.resize(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(queries.size()); i++) {
+        const Eigen::Vector3d &query = queries[i];
+        Eigen::Vector3d point = Eigen::Vector3d::Zero();
+        double distance2;
+        int tidx = ComputeClosestPoint(query, point, distance2, max_distance);
+        result.points_[i] = point;
+        result.triangle_indices_[i] = tidx;
+        if (tidx < 0) {
+            result.distances_[i] = std::numeric_limits<double>::infinity();
+            result.barycentric_coordinates_[i].setZero();
+            continue;
+        }
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        Eigen::Vector3d barycentric =
+                IntersectionTest::PointTriangleClosestPointBarycentric(
+                        query, vertices_[triangle(0)], vertices_[triangle(1)],
+                        vertices_[triangle(2)]);
+        result.barycentric_coordinates_[i] = barycentric;
+        double distance = std::sqrt(distance2);
+        if (signed_distance) {
+            // The closest point is on a vertex if two coordinates are zero,
+            // and on the edge opposite to a single zero coordinate.
+            int num_zeros = int(barycentric(0) == 0) +
+                            int(barycentric(1) == 0) +
+                            int(barycentric(2) == 0);
+            Eigen::Vector3d normal;
+            if (num_zeros == 2) {
+                int k;
+                barycentric.maxCoeff(&k);
+                normal = vertex_pseudonormals_[triangle(k)];
+            } else if (num_zeros == 1) {
+                int j;
+                barycentric.minCoeff(&j);
+                normal = edge_pseudonormals_[3 * tidx + (j + 1) % 3];
+            } else {
+                normal = triangle_normals_[tidx];
+            }
+            if ((query - point).dot(normal) < 0) {
+                distance = -distance;
+            }
+        }
+        result.distances_[i] = distance;
+    }
+    return result;
+}
+
+std::vector<Eigen::Vector2i> TriangleMeshBVH::ComputeSelfIntersections()
+        const {
+    std::vector<Eigen::Vector2i> intersections;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<Eigen::Vector2i> intersections_private;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256) nowait
+#endif
+        for (int tidx0 = 0; tidx0 < int(triangles_.size()); tidx0++) {
+            const Eigen::Vector3i &tria_p = triangles_[tidx0];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            const Eigen::Vector3d min_bound = p0.cwiseMin(p1).cwiseMin(p2);
+            const Eigen::Vector3d max_bound = p0.cwiseMax(p1).cwiseMax(p2);
+            Traverse(
+                    [&](const Node &node) {
+                        return IntersectionTest::AABBAABB(
+                                min_bound, max_bound, node.min_bound_,
+                                node.max_bound_);
+                    },
+                    [&](int tidx1) {
+                        if (tidx1 <= tidx0) {
+                            return true;
+                        }
+                        // check if neighbour triangle
+                        const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                        for (int i = 0; i < 3; i++) {
+                            if (tria_p(i) == tria_q(0) ||
+                                tria_p(i) == tria_q(1) ||
+                                tria_p(i) == tria_q(2)) {
+                                return true;
+                            }
+                        }
+                        if (IntersectionTest::TriangleTriangle3d(
+                                    p0, p1, p2, vertices_[tria_q(0)],
+                                    vertices_[tria_q(1)],
+                                    vertices_[tria_q(2)])) {
+                            intersections_private.push_back(
+                                    Eigen::Vector2i(tidx0, tidx1));
+                        }
+                        return true;
+                    });
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            intersections.insert(intersections.end(),
+                                 intersections_private.begin(),
+                                 intersections_private.end());
+        }
+    }
+    std::sort(intersections.begin(), intersections.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
+    return intersections;
+}
+
+bool TriangleMeshBVH::IsIntersecting(const TriangleMesh &mesh) const {
+    std::atomic<bool> intersecting(false);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int tidx0 = 0; tidx0 < int(mesh.triangles_.size()); tidx0++) {
+        if (intersecting.load()) {
+            continue;
+        }
+        const Eigen::Vector3i &tria_p = mesh.triangles_[tidx0];
+        const Eigen::Vector3d &p0 = mesh.vertices_[tria_p(0)];
+        const Eigen::Vector3d &p1 = mesh.vertices_[tria_p(1)];
+        const Eigen::Vector3d &p2 = mesh.vertices_[tria_p(2)];
+        const Eigen::Vector3d min_bound = p0.cwiseMin(p1).cwiseMin(p2);
+        const Eigen::Vector3d max_bound = p0.cwiseMax(p1).cwiseMax(p2);
+        Traverse(
+                [&](const Node &node) {
+                    return IntersectionTest::AABBAABB(min_bound, max_bound,
+                                                      node.min_bound_,
+                                                      node.max_bound_);
+                },
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                    if (IntersectionTest::TriangleTriangle3d(
+                                p0, p1, p2, vertices_[tria_q(0)],
+                                vertices_[tria_q(1)], vertices_[tria_q(2)])) {
+                        intersecting = true;
+                    }
+                    return !intersecting.load();
+                });
+    }
+    return intersecting;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <limits>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class ClosestPointResult
+///
+/// \brief Closest points on a triangle mesh for a batch of query points, as
+/// returned by TriangleMeshBVH::ComputeClosestPoints().
+class ClosestPointResult {
+public:
+    ClosestPointResult() {}
+    ~ClosestPointResult() {}
+
+public:
+    /// Distance of every query to the mesh, negative inside the mesh for
+    /// signed queries. Infinite if no triangle is within the cutoff.
+    std::vector<double> distances_;
+    /// Closest point on the mesh for every query.
+    std::vector<Eigen::Vector3d> points_;
+    /// Index of the triangle containing the closest point, or -1.
+    std::vector<int> triangle_indices_;
+    /// Barycentric coordinates of the closest point within its triangle.
+    std::vector<Eigen::Vector3d> barycentric_coordinates_;
+};
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh.
+///
+/// The hierarchy is a linear BVH: the triangles are sorted along a Morton
+/// curve through their centroids and every internal node is derived from the
+/// sorted codes independently, so the whole build runs in parallel (Karras,
+/// 'Maximizing Parallelism in the Construction of BVHs, Octrees, and k-d
+/// Trees', 2012). Every leaf holds a single triangle. The hierarchy keeps its
+/// own copy of the vertices and triangles, and queries are thread-safe.
+class TriangleMeshBVH {
+public:
+    /// \brief Default Constructor.
+    TriangleMeshBVH() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The triangle mesh from which the hierarchy is built.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh);
+    ~TriangleMeshBVH() {}
+
+public:
+    /// Builds the hierarchy over the triangles of \p mesh.
+    ///
+    /// \param mesh The triangle mesh from which the hierarchy is built.
+    bool SetTriangleMesh(const TriangleMesh &mesh);
+    /// Removes all triangles and nodes.
+    void Clear();
+    /// Returns the number of triangles in the hierarchy.
+    size_t NumTriangles() const { return triangles_.size(); }
+
+    /// Returns the indices of the triangles whose bounding box intersects the
+    /// box from \p min_bound to \p max_bound, in increasing order.
+    std::vector<int> QueryBoundingBox(const Eigen::Vector3d &min_bound,
+                                      const Eigen::Vector3d &max_bound) const;
+
+    /// \brief Finds the first triangle hit by a ray.
+    ///
+    /// \param origin Origin of the ray.
+    /// \param direction Direction of the ray, not necessarily normalized.
+    /// \param t Set to the ray parameter of the hit, such that the hit point
+    /// is origin + t * direction.
+    /// \param max_t Hits beyond this ray parameter are ignored.
+    /// \return The index of the hit triangle, or -1 if there is none.
+    int CastRay(const Eigen::Vector3d &origin,
+                const Eigen::Vector3d &direction,
+                double &t,
+                double max_t = std::numeric_limits<double>::infinity()) const;
+
+    /// \brief Finds the point of the mesh closest to \p query.
+    ///
+    /// \param query The query point.
+    /// \param closest_point Set to the closest point on the mesh.
+    /// \param distance2 Set to the squared distance to the closest point.
+    /// \param max_distance Triangles further away than this are ignored.
+    /// \return The index of the triangle containing the closest point, or -1
+    /// if no triangle is within \p max_distance.
+    int ComputeClosestPoint(const Eigen::Vector3d &query,
+                            Eigen::Vector3d &closest_point,
+                            double &distance2,
+                            double max_distance =
+                                    std::numeric_limits<double>::infinity())
+            const;
+
+    /// \brief Finds the closest points on the mesh for a batch of queries, in
+    /// parallel.
+    ///
+    /// The sign of the distance is taken from the angle weighted pseudonormal
+    /// of the face, edge or vertex containing the closest point (Baerentzen
+    /// and Aanaes, 'Signed Distance Computation Using the Angle Weighted
+    /// Pseudonormal', 2005). It is only meaningful for closed, consistently
+    /// oriented meshes.
+    ///
+    /// \param queries The query points.
+    /// \param signed_distance If true, distances of queries inside the mesh
+    /// are negative.
+    /// \param max_distance Queries further away than this from every
+    /// triangle get an infinite distance and triangle index -1.
+    ClosestPointResult ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &queries,
+            bool signed_distance = false,
+            double max_distance = std::numeric_limits<double>::infinity())
+            const;
+
+    /// Returns all pairs (i, j) with i < j of intersecting triangles that do
+    /// not share a vertex, sorted lexicographically.
+    std::vector<Eigen::Vector2i> ComputeSelfIntersections() const;
+
+    /// Returns true if any triangle of \p mesh intersects a triangle of the
+    /// hierarchy.
+    bool IsIntersecting(const TriangleMesh &mesh) const;
+
+private:
+    /// Node of the hierarchy. Internal nodes come first, followed by one leaf
+    /// per triangle, and the root is node 0.
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        /// Children of an internal node, unused for leaves.
+        int left_;
+        int right_;
+    };
+
+    /// Calls \p visit with the index of every triangle in a leaf reached by
+    /// descending into the nodes for which \p enter returns true. The
+    /// traversal stops early when \p visit returns false.
+    template <typename EnterNode, typename VisitTriangle>
+    void Traverse(const EnterNode &enter, const VisitTriangle &visit) const;
+
+    bool IsLeaf(int node) const { return node >= int(triangles_.size()) - 1; }
+    int LeafTriangle(int node) const {
+        return leaf_triangles_[node - (int(triangles_.size()) - 1)];
+    }
+
+    /// Computes the pseudonormals used for the sign of distances.
+    void ComputePseudonormals();
+
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Node> nodes_;
+    /// Angle weighted pseudonormals of every vertex.
+    std::vector<Eigen::Vector3d> vertex_pseudonormals_;
+    /// Pseudonormal of edge k, from vertex k to vertex (k + 1) % 3, of
+    /// triangle t at index 3 * t + k.
+    std::vector<Eigen::Vector3d> edge_pseudonormals_;
+    /// Unit normal of every triangle.
+    std::vector<Eigen::Vector3d> triangle_normals_;
+    /// Triangle index of every leaf, in Morton order.
+    std::vector<int> leaf_triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include <Eigen/Sparse>
 #include <algorithm>
 
+#include "Open3D/Geometry/VertexAdjacency.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
@@ -44,7 +45,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
     prime->triangles_ = this->triangles_;
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
+    VertexAdjacency adjacency;
+    adjacency.ComputeFromTriangles(prime->vertices_.size(), prime->triangles_);
+    prime->adjacency_list_ = adjacency.ToAdjacencyList();
     auto edges_to_vertices = prime->GetEdgeToVerticesMap();
     auto edge_weights =
             prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
@@ -67,7 +70,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             triplets.push_back(Eigen::Triplet<double>(i, i, 1));
         } else {
             double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
+            const int *neighbors = adjacency.NeighborIndices(i);
+            for (int k = 0; k < adjacency.NumNeighbors(i); ++k) {
+                int j = neighbors[k];
                 double w = edge_weights[GetOrderedEdge(i, j)];
                 triplets.push_back(Eigen::Triplet<double>(i, j, -w));
                 W += w;
@@ -105,7 +110,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         for (int i = 0; i < int(vertices_.size()); ++i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
-            for (int j : prime->adjacency_list_[i]) {
+            const int *neighbors = adjacency.NeighborIndices(i);
+            for (int k = 0; k < adjacency.NumNeighbors(i); ++k) {
+                int j = neighbors[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
                 double w = edge_weights[GetOrderedEdge(i, j)];
@@ -135,7 +142,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             if (constraints.count(i) > 0) {
                 bi = constraints[i];
             } else {
-                for (int j : prime->adjacency_list_[i]) {
+                const int *neighbors = adjacency.NeighborIndices(i);
+                for (int k = 0; k < adjacency.NumNeighbors(i); ++k) {
+                    int j = neighbors[k];
                     double w = edge_weights[GetOrderedEdge(i, j)];
                     bi += w / 2 *
                           ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
@@ -162,7 +171,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         // Compute energy and log
         double energy = 0;
         for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
+            const int *neighbors = adjacency.NeighborIndices(i);
+            for (int k = 0; k < adjacency.NumNeighbors(i); ++k) {
+                int j = neighbors[k];
                 double w = edge_weights[GetOrderedEdge(i, j)];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
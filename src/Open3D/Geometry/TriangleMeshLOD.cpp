@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshLOD.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Returns the mesh made of the triangles \p triangle_ids of \p mesh and the
+/// vertices they reference.
+std::shared_ptr<TriangleMesh> ExtractTriangles(
+        const TriangleMesh &mesh,
+        const std::vector<size_t> &triangle_ids) {
+    std::vector<int> vertex_ids;
+    vertex_ids.reserve(3 * triangle_ids.size());
+    for (size_t tidx : triangle_ids) {
+        for (int k = 0; k < 3; ++k) {
+            vertex_ids.push_back(mesh.triangles_[tidx](k));
+        }
+    }
+    std::sort(vertex_ids.begin(), vertex_ids.end());
+    vertex_ids.erase(std::unique(vertex_ids.begin(), vertex_ids.end()),
+                     vertex_ids.end());
+
+    auto tile = std::make_shared<TriangleMesh>();
+    for (int vidx : vertex_ids) {
+        tile->vertices_.push_back(mesh.vertices_[vidx]);
+        if (mesh.HasVertexNormals()) {
+            tile->vertex_normals_.push_back(mesh.vertex_normals_[vidx]);
+        }
+        if (mesh.HasVertexColors()) {
+            tile->vertex_colors_.push_back(mesh.vertex_colors_[vidx]);
+        }
+    }
+    for (size_t tidx : triangle_ids) {
+        Eigen::Vector3i triangle;
+        for (int k = 0; k < 3; ++k) {
+            triangle(k) = int(std::lower_bound(vertex_ids.begin(),
+                                               vertex_ids.end(),
+                                               mesh.triangles_[tidx](k)) -
+                              vertex_ids.begin());
+        }
+        tile->triangles_.push_back(triangle);
+        if (mesh.HasTriangleNormals()) {
+            tile->triangle_normals_.push_back(mesh.triangle_normals_[tidx]);
+        }
+    }
+    return tile;
+}
+
+}  // unnamed namespace
+
+TriangleMeshLOD &TriangleMeshLOD::Clear() {
+    origin_.setZero();
+    tile_size_ = 0;
+    tile_depth_ = 0;
+    tile_indices_.clear();
+    levels_.clear();
+    return *this;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMeshLOD::GetLevel(size_t level) const {
+    if (level >= levels_.size()) {
+        utility::LogError("[GetLevel] level {:d} does not exist.", level);
+    }
+    auto mesh = std::make_shared<TriangleMesh>();
+    for (const auto &tile : levels_[level]) {
+        *mesh += *tile;
+    }
+    return mesh;
+}
+
+AxisAlignedBoundingBox TriangleMeshLOD::GetTileBound(size_t tile) const {
+    if (tile >= tile_indices_.size()) {
+        utility::LogError("[GetTileBound] tile {:d} does not exist.", tile);
+    }
+    Eigen::Vector3d min_bound =
+            origin_ + tile_indices_[tile].cast<double>() * tile_size_;
+    return AxisAlignedBoundingBox(
+            min_bound, min_bound + Eigen::Vector3d::Constant(tile_size_));
+}
+
+std::shared_ptr<TriangleMeshLOD> TriangleMeshLOD::CreateFromTriangleMesh(
+        const TriangleMesh &mesh,
+        int number_of_levels,
+        double reduction /* = 0.25 */,
+        int tile_depth /* = 0 */) {
+    if (number_of_levels < 1) {
+        utility::LogError("[CreateFromTriangleMesh] number_of_levels < 1.");
+    }
+    if (!(reduction > 0 && reduction < 1)) {
+        utility::LogError(
+                "[CreateFromTriangleMesh] reduction has to be in (0, 1).");
+    }
+    if (tile_depth < 0 || tile_depth > 10) {
+        utility::LogError(
+                "[CreateFromTriangleMesh] tile_depth has to be in [0, 10].");
+    }
+    auto lod = std::make_shared<TriangleMeshLOD>();
+    lod->tile_depth_ = tile_depth;
+    lod->origin_ = mesh.GetMinBound();
+    double extent = (mesh.GetMaxBound() - mesh.GetMinBound()).maxCoeff();
+    int num_cells = 1 << tile_depth;
+    lod->tile_size_ = (extent > 0 ? extent : 1.0) / num_cells;
+
+    // Sort the triangles by the cell of their centroid
+    typedef std::pair<uint64_t, size_t> KeyTriangle;
+    int num_triangles = int(mesh.triangles_.size());
+    std::vector<KeyTriangle> keys(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        Eigen::Vector3d centroid = (mesh.vertices_[triangle(0)] +
+                                    mesh.vertices_[triangle(1)] +
+                                    mesh.vertices_[triangle(2)]) /
+                                   3.0;
+        uint64_t key = 0;
+        for (int d = 0; d < 3; ++d) {
+            double cell = std::floor((centroid(d) - lod->origin_(d)) /
+                                     lod->tile_size_);
+            cell = std::min(std::max(cell, 0.0), double(num_cells - 1));
+            key = (key << tile_depth) | uint64_t(cell);
+        }
+        keys[tidx] = KeyTriangle(key, size_t(tidx));
+    }
+    utility::ParallelSort(keys);
+    std::vector<std::vector<size_t>> tile_triangles;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            uint64_t key = keys[i].first;
+            uint64_t mask = uint64_t(num_cells - 1);
+            lod->tile_indices_.push_back(
+                    Eigen::Vector3i(int((key >> (2 * tile_depth)) & mask),
+                                    int((key >> tile_depth) & mask),
+                                    int(key & mask)));
+            tile_triangles.emplace_back();
+        }
+        tile_triangles.back().push_back(keys[i].second);
+    }
+
+    // Each level of a tile is simplified from the previous level. Nested
+    // parallel regions are serialized, so the tile loop is not parallel when
+    // there is a single tile and the decimation's own parallel loops can run.
+    int num_tiles = int(lod->tile_indices_.size());
+    lod->levels_.resize(number_of_levels,
+                        std::vector<std::shared_ptr<TriangleMesh>>(num_tiles));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (num_tiles > 1)
+#endif
+    for (int t = 0; t < num_tiles; ++t) {
+        lod->levels_[0][t] = ExtractTriangles(mesh, tile_triangles[t]);
+        for (int level = 1; level < number_of_levels; ++level) {
+            const TriangleMesh &previous = *lod->levels_[level - 1][t];
+            int target = int(std::ceil(reduction *
+                                       double(previous.triangles_.size())));
+            lod->levels_[level][t] = previous.SimplifyQuadricDecimation(target);
+        }
+    }
+    return lod;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshLOD
+///
+/// \brief Level of detail hierarchy of a triangle mesh.
+///
+/// Level 0 is the input mesh, and every further level is simplified from the
+/// previous one with quadric decimation, so the whole chain costs little more
+/// than the first simplification. The mesh can be split into tiles, the cells
+/// of one level of an octree over its bounding cube. Tiles are simplified in
+/// parallel and can be loaded independently. Tile borders are mesh
+/// boundaries for the decimation, which keeps them close to their original
+/// position.
+class TriangleMeshLOD {
+public:
+    /// \brief Default Constructor.
+    TriangleMeshLOD() {}
+    ~TriangleMeshLOD() {}
+
+public:
+    /// Removes all levels and tiles.
+    TriangleMeshLOD &Clear();
+    /// Returns `true` if the hierarchy has no level.
+    bool IsEmpty() const { return levels_.empty(); }
+    /// Returns the number of levels.
+    size_t NumLevels() const { return levels_.size(); }
+    /// Returns the number of tiles of every level.
+    size_t NumTiles() const { return tile_indices_.size(); }
+    /// Returns the tiles of \p level merged into one mesh. Vertices on the
+    /// tile borders are duplicated.
+    std::shared_ptr<TriangleMesh> GetLevel(size_t level) const;
+    /// Returns the cell of \p tile.
+    AxisAlignedBoundingBox GetTileBound(size_t tile) const;
+
+    /// Factory function to build the hierarchy of \p mesh.
+    ///
+    /// \param mesh The full resolution mesh.
+    /// \param number_of_levels Number of levels, including the input mesh.
+    /// \param reduction Ratio of the number of triangles of a level to the
+    /// number of triangles of the previous level, in (0, 1).
+    /// \param tile_depth The bounding cube of the mesh is split into
+    /// 2^tile_depth cells per axis, and every cell containing triangle
+    /// centroids is a tile. 0 gives a single tile.
+    static std::shared_ptr<TriangleMeshLOD> CreateFromTriangleMesh(
+            const TriangleMesh &mesh,
+            int number_of_levels,
+            double reduction = 0.25,
+            int tile_depth = 0);
+
+public:
+    /// Minimum corner of the bounding cube of the tiles.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Edge length of a tile.
+    double tile_size_ = 0;
+    /// The cube is split into 2^tile_depth_ cells per axis.
+    int tile_depth_ = 0;
+    /// Cell of every tile, in increasing order.
+    std::vector<Eigen::Vector3i> tile_indices_;
+    /// levels_[l][t] is tile t of level l.
+    std::vector<std::vector<std::shared_ptr<TriangleMesh>>> levels_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
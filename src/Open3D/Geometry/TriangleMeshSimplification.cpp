@@ -27,10 +27,16 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
+#include "Open3D/Geometry/VertexAdjacency.h"
+#include "Open3D/Geometry/VertexClustering.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -98,7 +104,6 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
                 "[SimplifyVertexClustering] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    auto mesh = std::make_shared<TriangleMesh>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelGridFromPointCloud] voxel_size <= 0.0");
     }
@@ -107,439 +112,574 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
             Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
     Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
     Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
-    if (voxel_size * std::numeric_limits<int>::max() <
+    if (voxel_size * double(1 << 20) <
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelGridFromPointCloud] voxel_size is too small.");
     }
 
-    auto GetVoxelIdx = [&](const Eigen::Vector3d& vert) {
-        Eigen::Vector3d ref_coord = (vert - voxel_min_bound) / voxel_size;
-        Eigen::Vector3i idx(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                            int(floor(ref_coord(2))));
-        return idx;
-    };
+    VertexClustering clustering(voxel_size, contraction, voxel_min_bound);
+    clustering.AddMesh(*this);
+    return clustering.ExtractTriangleMesh();
+}
 
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vert_ind;
-    int new_vidx = 0;
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(int(vidx));
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
-        }
+namespace {
+
+/// Candidate collapse of the edge (vidx0_, vidx1_) into the position vbar_.
+/// Candidates are never removed from the queue. A candidate is stale once
+/// either vertex changed after it was computed, which the stamps detect.
+struct EdgeCollapse {
+    double cost_;
+    int vidx0_;
+    int vidx1_;
+    int stamp0_;
+    int stamp1_;
+    Eigen::Vector3d vbar_;
+
+    /// Orders candidates so that a std::priority_queue returns the cheapest.
+    bool operator<(const EdgeCollapse& other) const {
+        return cost_ > other.cost_;
     }
+};
+
+/// Edge collapse state of a quadric decimation. Quadrics, incident triangles
+/// and change stamps are stored in flat per vertex arrays.
+class QuadricDecimation {
+public:
+    explicit QuadricDecimation(TriangleMesh& mesh);
+
+public:
+    /// Collapses the cheapest edge until the target is reached.
+    void SimplifyGreedy(int target_number_of_triangles);
+    /// Collapses rounds of independent edges in parallel until the target is
+    /// reached. The candidates of a round are the edges with a cost at most
+    /// the lower quartile of all edge costs. Each candidate gets a random key
+    /// and is collapsed if no candidate touching the one-rings of its
+    /// vertices has a smaller key.
+    void SimplifyIndependentSets(int target_number_of_triangles);
+    /// Removes the collapsed vertices and triangles from the mesh.
+    void Compact();
+
+private:
+    EdgeCollapse ComputeCollapse(int vidx0, int vidx1) const;
+    bool IsBoundaryEdge(int vidx0, int vidx1) const;
+    bool IsFlipping(const EdgeCollapse& collapse) const;
+    int NumCollapsedTriangles(const EdgeCollapse& collapse) const;
+    int Collapse(const EdgeCollapse& collapse);
+
+private:
+    TriangleMesh& mesh_;
+    bool has_vert_normal_;
+    bool has_vert_color_;
+    int n_triangles_;
+    std::vector<Quadric> Qs_;
+    std::vector<std::vector<int>> vert_to_triangles_;
+    std::vector<int> stamps_;
+    std::vector<char> vertices_deleted_;
+    std::vector<char> triangles_deleted_;
+};
 
-    // aggregate vertex info
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
-    if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
+QuadricDecimation::QuadricDecimation(TriangleMesh& mesh)
+    : mesh_(mesh),
+      has_vert_normal_(mesh.HasVertexNormals()),
+      has_vert_color_(mesh.HasVertexColors()),
+      n_triangles_(int(mesh.triangles_.size())),
+      Qs_(mesh.vertices_.size()),
+      vert_to_triangles_(mesh.vertices_.size()),
+      stamps_(mesh.vertices_.size(), 0),
+      vertices_deleted_(mesh.vertices_.size(), 0),
+      triangles_deleted_(mesh.triangles_.size(), 0) {
+    int num_vertices = int(mesh_.vertices_.size());
+    int num_triangles = int(mesh_.triangles_.size());
+
+    // Map vertices to triangles, once per distinct vertex of a triangle
+    std::vector<int> num_incident(num_vertices, 0);
+    for (const auto& tria : mesh_.triangles_) {
+        num_incident[tria(0)]++;
+        if (tria(1) != tria(0)) num_incident[tria(1)]++;
+        if (tria(2) != tria(0) && tria(2) != tria(1)) num_incident[tria(2)]++;
     }
-    if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        vert_to_triangles_[vidx].reserve(num_incident[vidx]);
     }
-
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertices_[vidx];
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const auto& tria = mesh_.triangles_[tidx];
+        vert_to_triangles_[tria(0)].push_back(tidx);
+        if (tria(1) != tria(0)) vert_to_triangles_[tria(1)].push_back(tidx);
+        if (tria(2) != tria(0) && tria(2) != tria(1)) {
+            vert_to_triangles_[tria(2)].push_back(tidx);
         }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_normals_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_colors_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
+    }
 
-    if (contraction == SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+    // Compute triangle planes and areas
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        triangle_planes[tidx] = mesh_.GetTrianglePlane(tidx);
+        triangle_areas[tidx] = mesh_.GetTriangleArea(tidx);
+    }
+
+    // Compute the error metric per vertex. Boundary edges add a plane
+    // perpendicular to their triangle to both of their vertices.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        for (int tidx : vert_to_triangles_[vidx]) {
+            double area = triangle_areas[tidx];
+            Qs_[vidx] += Quadric(triangle_planes[tidx], area);
+
+            const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+            int k = vidx == tria(0) ? 0 : (vidx == tria(1) ? 1 : 2);
+            for (int other : {tria((k + 1) % 3), tria((k + 2) % 3)}) {
+                if (other == vidx || !IsBoundaryEdge(vidx, other)) {
+                    continue;
+                }
+                const Eigen::Vector3d& vert0 = mesh_.vertices_[vidx];
+                const Eigen::Vector3d& vert1 = mesh_.vertices_[other];
+                Eigen::Vector4d plane = TriangleMesh::ComputeTrianglePlane(
+                        vert0, vert1, vert0 + triangle_planes[tidx].head<3>());
+                Qs_[vidx] += Quadric(plane, area);
             }
         }
-    } else if (contraction == SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-            vert_to_triangles[triangles_[tidx](0)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](1)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](2)].emplace(int(tidx));
+    }
+}
+
+bool QuadricDecimation::IsBoundaryEdge(int vidx0, int vidx1) const {
+    int count = 0;
+    for (int tidx : vert_to_triangles_[vidx0]) {
+        if (triangles_deleted_[tidx]) {
+            continue;
         }
+        const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+        if (vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2)) {
+            count++;
+        }
+    }
+    return count == 1;
+}
 
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
+EdgeCollapse QuadricDecimation::ComputeCollapse(int vidx0, int vidx1) const {
+    EdgeCollapse collapse;
+    collapse.vidx0_ = vidx0;
+    collapse.vidx1_ = vidx1;
+    collapse.stamp0_ = stamps_[vidx0];
+    collapse.stamp1_ = stamps_[vidx1];
+    Quadric Qbar = Qs_[vidx0] + Qs_[vidx1];
+    if (Qbar.IsInvertible()) {
+        collapse.vbar_ = Qbar.Minimum();
+        collapse.cost_ = Qbar.Eval(collapse.vbar_);
+    } else {
+        const Eigen::Vector3d& v0 = mesh_.vertices_[vidx0];
+        const Eigen::Vector3d& v1 = mesh_.vertices_[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        collapse.cost_ = std::min(cost0, std::min(cost1, costmid));
+        if (collapse.cost_ == costmid) {
+            collapse.vbar_ = vmid;
+        } else if (collapse.cost_ == cost0) {
+            collapse.vbar_ = v0;
+        } else {
+            collapse.vbar_ = v1;
+        }
+    }
+    return collapse;
+}
 
-            Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
-                    Eigen::Vector4d p = GetTrianglePlane(tidx);
-                    double area = GetTriangleArea(tidx);
-                    q += Quadric(p, area);
-                }
+bool QuadricDecimation::IsFlipping(const EdgeCollapse& collapse) const {
+    // Both vertices move to vbar, so the triangles of both are checked, except
+    // for the triangles on the edge that are removed.
+    for (int vidx : {collapse.vidx0_, collapse.vidx1_}) {
+        int other = vidx == collapse.vidx0_ ? collapse.vidx1_ : collapse.vidx0_;
+        for (int tidx : vert_to_triangles_[vidx]) {
+            if (triangles_deleted_[tidx]) {
+                continue;
             }
-            if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
-            } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
+            const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+            if (other == tria(0) || other == tria(1) || other == tria(2)) {
+                continue;
             }
-
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
+            Eigen::Vector3d vert0 = mesh_.vertices_[tria(0)];
+            Eigen::Vector3d vert1 = mesh_.vertices_[tria(1)];
+            Eigen::Vector3d vert2 = mesh_.vertices_[tria(2)];
+            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+            if (vidx == tria(0)) {
+                vert0 = collapse.vbar_;
+            } else if (vidx == tria(1)) {
+                vert1 = collapse.vbar_;
+            } else {
+                vert2 = collapse.vbar_;
             }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+            if (norm_before.dot(norm_after) < 0) {
+                return true;
             }
         }
     }
+    return false;
+}
+
+int QuadricDecimation::NumCollapsedTriangles(
+        const EdgeCollapse& collapse) const {
+    int count = 0;
+    for (int tidx : vert_to_triangles_[collapse.vidx1_]) {
+        const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+        if (!triangles_deleted_[tidx] &&
+            (collapse.vidx0_ == tria(0) || collapse.vidx0_ == tria(1) ||
+             collapse.vidx0_ == tria(2))) {
+            count++;
+        }
+    }
+    return count;
+}
 
-    //  connect vertices
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(2)])];
+int QuadricDecimation::Collapse(const EdgeCollapse& collapse) {
+    int vidx0 = collapse.vidx0_;
+    int vidx1 = collapse.vidx1_;
 
-        // only connect if in different voxels
-        if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
+    // Connect triangles from vidx1 to vidx0, or mark deleted
+    int num_deleted = 0;
+    std::vector<int>& triangles0 = vert_to_triangles_[vidx0];
+    for (int tidx : vert_to_triangles_[vidx1]) {
+        if (triangles_deleted_[tidx]) {
             continue;
         }
-
-        // Note: there can be still double faces with different orientation
-        // The user has to clean up manually
-        if (vidx1 < vidx0 && vidx1 < vidx2) {
-            int tmp = vidx0;
-            vidx0 = vidx1;
-            vidx1 = vidx2;
-            vidx2 = tmp;
-        } else if (vidx2 < vidx0 && vidx2 < vidx1) {
-            int tmp = vidx1;
-            vidx1 = vidx0;
-            vidx0 = vidx2;
-            vidx2 = tmp;
+        Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+        if (vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2)) {
+            triangles_deleted_[tidx] = 1;
+            num_deleted++;
+            continue;
         }
-
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
+        if (vidx1 == tria(0)) {
+            tria(0) = vidx0;
+        } else if (vidx1 == tria(1)) {
+            tria(1) = vidx0;
+        } else {
+            tria(2) = vidx0;
+        }
+        triangles0.push_back(tidx);
     }
-
-    mesh->triangles_.resize(triangles.size());
-    int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
-        mesh->triangles_[tidx] = triangle;
-        tidx++;
+    std::vector<int>().swap(vert_to_triangles_[vidx1]);
+    triangles0.erase(std::remove_if(triangles0.begin(), triangles0.end(),
+                                    [&](int tidx) {
+                                        return triangles_deleted_[tidx] != 0;
+                                    }),
+                     triangles0.end());
+
+    // update vertex vidx0 to vbar
+    mesh_.vertices_[vidx0] = collapse.vbar_;
+    Qs_[vidx0] += Qs_[vidx1];
+    if (has_vert_normal_) {
+        mesh_.vertex_normals_[vidx0] = 0.5 * (mesh_.vertex_normals_[vidx0] +
+                                              mesh_.vertex_normals_[vidx1]);
     }
-
-    if (HasTriangleNormals()) {
-        mesh->ComputeTriangleNormals();
+    if (has_vert_color_) {
+        mesh_.vertex_colors_[vidx0] = 0.5 * (mesh_.vertex_colors_[vidx0] +
+                                             mesh_.vertex_colors_[vidx1]);
     }
-
-    return mesh;
+    vertices_deleted_[vidx1] = 1;
+    stamps_[vidx0]++;
+    return num_deleted;
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
-        int target_number_of_triangles) const {
-    if (HasTriangleUvs()) {
-        utility::LogWarning(
-                "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
-                "that are not handled in this function");
-    }
-    typedef std::tuple<double, int, int> CostEdge;
-
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = vertices_;
-    mesh->vertex_normals_ = vertex_normals_;
-    mesh->vertex_colors_ = vertex_colors_;
-    mesh->triangles_ = triangles_;
-
-    std::vector<bool> vertices_deleted(vertices_.size(), false);
-    std::vector<bool> triangles_deleted(triangles_.size(), false);
-
-    // Map vertices to triangles and compute triangle planes and areas
-    std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    std::vector<Eigen::Vector4d> triangle_planes(triangles_.size());
-    std::vector<double> triangle_areas(triangles_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        vert_to_triangles[triangles_[tidx](0)].emplace(static_cast<int>(tidx));
-        vert_to_triangles[triangles_[tidx](1)].emplace(static_cast<int>(tidx));
-        vert_to_triangles[triangles_[tidx](2)].emplace(static_cast<int>(tidx));
-
-        triangle_planes[tidx] = GetTrianglePlane(tidx);
-        triangle_areas[tidx] = GetTriangleArea(tidx);
+void QuadricDecimation::SimplifyGreedy(int target_number_of_triangles) {
+    // Add every edge once, from its smaller vertex
+    VertexAdjacency adjacency;
+    adjacency.ComputeFromTriangles(mesh_.vertices_.size(), mesh_.triangles_);
+    int num_vertices = int(adjacency.NumVertices());
+    std::vector<size_t> offsets(num_vertices + 1, 0);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        const int* begin = adjacency.NeighborIndices(vidx);
+        const int* end = begin + adjacency.NumNeighbors(vidx);
+        offsets[vidx + 1] = offsets[vidx] + (end - std::upper_bound(
+                                                           begin, end, vidx));
     }
-
-    // Compute the error metric per vertex
-    std::vector<Quadric> Qs(vertices_.size());
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        for (int tidx : vert_to_triangles[vidx]) {
-            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+    std::vector<EdgeCollapse> candidates(offsets[num_vertices]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        const int* end =
+                adjacency.NeighborIndices(vidx) + adjacency.NumNeighbors(vidx);
+        const int* nb = end - (offsets[vidx + 1] - offsets[vidx]);
+        for (size_t i = offsets[vidx]; nb != end; ++i, ++nb) {
+            candidates[i] = ComputeCollapse(vidx, *nb);
         }
     }
+    std::priority_queue<EdgeCollapse> queue(std::less<EdgeCollapse>(),
+                                            std::move(candidates));
 
-    // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
-                                   double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
-            return;
+    // perform incremental edge collapse
+    std::vector<int> neighbors;
+    while (n_triangles_ > target_number_of_triangles && !queue.empty()) {
+        EdgeCollapse collapse = queue.top();
+        queue.pop();
+        int vidx0 = collapse.vidx0_;
+        int vidx1 = collapse.vidx1_;
+        if (vertices_deleted_[vidx0] || vertices_deleted_[vidx1] ||
+            collapse.stamp0_ != stamps_[vidx0] ||
+            collapse.stamp1_ != stamps_[vidx1]) {
+            continue;
         }
-        const auto& vert0 = mesh->vertices_[vidx0];
-        const auto& vert1 = mesh->vertices_[vidx1];
-        const auto& vert2 = mesh->vertices_[vidx2];
-        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
-        Eigen::Vector4d plane = ComputeTrianglePlane(vert0, vert1, vert2p);
-        Quadric quad(plane, area);
-        Qs[vidx0] += quad;
-        Qs[vidx1] += quad;
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
-    }
-
-    // Get valid edges and compute cost
-    // Note: We could also select all vertex pairs as edges with dist < eps
-    std::unordered_map<Eigen::Vector2i, Eigen::Vector3d,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            vbars;
-    std::unordered_map<Eigen::Vector2i, double,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            costs;
-    auto CostEdgeComp = [](const CostEdge& a, const CostEdge& b) {
-        return std::get<0>(a) > std::get<0>(b);
-    };
-    std::priority_queue<CostEdge, std::vector<CostEdge>, decltype(CostEdgeComp)>
-            queue(CostEdgeComp);
-
-    auto AddEdge = [&](int vidx0, int vidx1, bool update) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (update || vbars.count(edge) == 0) {
-            const Quadric& Q0 = Qs[min];
-            const Quadric& Q1 = Qs[max];
-            Quadric Qbar = Q0 + Q1;
-            double cost;
-            Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx0];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vbar);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
-                }
+        if (IsFlipping(collapse)) {
+            continue;
+        }
+        n_triangles_ -= Collapse(collapse);
+
+        // Update edge costs for all edges connecting to vidx0
+        neighbors.clear();
+        for (int tidx : vert_to_triangles_[vidx0]) {
+            const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) != vidx0) neighbors.push_back(tria(k));
             }
-            vbars[edge] = vbar;
-            costs[edge] = cost;
-            queue.push(CostEdge(cost, min, max));
         }
-    };
-
-    // add all edges to priority queue
-    for (const auto& triangle : triangles_) {
-        AddEdge(triangle(0), triangle(1), false);
-        AddEdge(triangle(1), triangle(2), false);
-        AddEdge(triangle(2), triangle(0), false);
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+        for (int nb : neighbors) {
+            queue.push(ComputeCollapse(std::min(vidx0, nb),
+                                       std::max(vidx0, nb)));
+        }
     }
+}
 
-    // perform incremental edge collapse
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-    int n_triangles = int(triangles_.size());
-    while (n_triangles > target_number_of_triangles && !queue.empty()) {
-        // retrieve edge from queue
-        double cost;
-        int vidx0, vidx1;
-        std::tie(cost, vidx0, vidx1) = queue.top();
-        queue.pop();
-
-        // test if the edge has been updated (reinserted into queue)
-        Eigen::Vector2i edge(vidx0, vidx1);
-        bool valid = !vertices_deleted[vidx0] && !vertices_deleted[vidx1] &&
-                     cost == costs[edge];
-        if (!valid) {
-            continue;
-        }
+void QuadricDecimation::SimplifyIndependentSets(
+        int target_number_of_triangles) {
+    // Candidate edges are keyed by a random number rather than by their cost.
+    // A smooth cost field has few local minima, so selecting the locally
+    // cheapest edges would collapse only a handful of edges per round.
+    typedef std::tuple<uint64_t, int, int> KeyedEdge;
+    const KeyedEdge no_edge(std::numeric_limits<uint64_t>::max(), -1, -1);
+    const double infinity = std::numeric_limits<double>::infinity();
+    int num_vertices = int(mesh_.vertices_.size());
+
+    // Sorted neighbors of every vertex and the costs of its edges to larger
+    // neighbors, infinite if the collapse flips a triangle. A collapse only
+    // changes the quadrics, triangles and positions within the one-rings of
+    // its edge, so only the rows of these dirty vertices are recomputed.
+    std::vector<std::vector<int>> neighbors(num_vertices);
+    std::vector<std::vector<double>> costs(num_vertices);
+    std::vector<char> dirty(num_vertices, 1);
+    auto EdgeCost = [&](int vidx0, int vidx1) {
+        const int* begin = neighbors[vidx0].data();
+        const int* end = begin + neighbors[vidx0].size();
+        return costs[vidx0][std::lower_bound(begin, end, vidx1) - begin];
+    };
 
-        // avoid flip of triangle normal
-        bool flipped = false;
-        for (int tidx : vert_to_triangles[vidx1]) {
-            if (triangles_deleted[tidx]) {
+    for (uint64_t round = 0; n_triangles_ > target_number_of_triangles;
+         ++round) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            if (!dirty[vidx]) {
                 continue;
             }
-
-            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            bool has_vidx0 =
-                    vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
-            bool has_vidx1 =
-                    vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
-            if (has_vidx0 && has_vidx1) {
-                continue;
+            std::vector<int>& nbs = neighbors[vidx];
+            nbs.clear();
+            for (int tidx : vert_to_triangles_[vidx]) {
+                if (triangles_deleted_[tidx]) {
+                    continue;
+                }
+                const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) != vidx) nbs.push_back(tria(k));
+                }
             }
-
-            Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
-            Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
-            Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
-            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
-            norm_before /= norm_before.norm();
-
-            if (vidx1 == tria(0)) {
-                vert0 = vbars[edge];
-            } else if (vidx1 == tria(1)) {
-                vert1 = vbars[edge];
-            } else if (vidx1 == tria(2)) {
-                vert2 = vbars[edge];
+            std::sort(nbs.begin(), nbs.end());
+            nbs.erase(std::unique(nbs.begin(), nbs.end()), nbs.end());
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            const std::vector<int>& nbs = neighbors[vidx];
+            costs[vidx].resize(nbs.size(), infinity);
+            for (size_t k = 0; k < nbs.size(); ++k) {
+                int nb = nbs[k];
+                if (nb < vidx || (!dirty[vidx] && !dirty[nb])) {
+                    continue;
+                }
+                EdgeCollapse collapse = ComputeCollapse(vidx, nb);
+                costs[vidx][k] =
+                        IsFlipping(collapse) ? infinity : collapse.cost_;
             }
-
-            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
-            norm_after /= norm_after.norm();
-            if (norm_before.dot(norm_after) < 0) {
-                flipped = true;
-                break;
+        }
+        std::fill(dirty.begin(), dirty.end(), 0);
+
+        // Candidates are the edges with a cost at most the lower quartile
+        std::vector<double> finite_costs;
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            for (size_t k = 0; k < neighbors[vidx].size(); ++k) {
+                if (neighbors[vidx][k] > vidx && costs[vidx][k] < infinity) {
+                    finite_costs.push_back(costs[vidx][k]);
+                }
             }
         }
-        if (flipped) {
-            continue;
+        if (finite_costs.empty()) {
+            break;
         }
-
-        // Connect triangles from vidx1 to vidx0, or mark deleted
-        for (int tidx : vert_to_triangles[vidx1]) {
-            if (triangles_deleted[tidx]) {
-                continue;
+        auto quantile = finite_costs.begin() + finite_costs.size() / 4;
+        std::nth_element(finite_costs.begin(), quantile, finite_costs.end());
+        double max_cost = *quantile;
+
+        // Candidate with the smallest key of every vertex
+        std::vector<KeyedEdge> best(num_vertices, no_edge);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            for (int nb : neighbors[vidx]) {
+                int vidx0 = std::min(vidx, nb);
+                int vidx1 = std::max(vidx, nb);
+                if (EdgeCost(vidx0, vidx1) > max_cost) {
+                    continue;
+                }
+                utility::RandomStream random(
+                        round, (uint64_t(vidx0) << 32) | uint64_t(vidx1));
+                KeyedEdge edge(random.NextUInt64(), vidx0, vidx1);
+                if (edge < best[vidx]) {
+                    best[vidx] = edge;
+                }
             }
-
-            Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            bool has_vidx0 =
-                    vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
-            bool has_vidx1 =
-                    vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
-
-            if (has_vidx0 && has_vidx1) {
-                triangles_deleted[tidx] = true;
-                n_triangles--;
+        }
+        // A candidate is collapsed if no candidate touching the one-rings of
+        // its vertices has a smaller key. The one-rings of two such edges
+        // are disjoint, so they are collapsed independently.
+        std::vector<char> selected(num_vertices, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            const KeyedEdge& edge = best[vidx];
+            if (std::get<1>(edge) != vidx || best[std::get<2>(edge)] != edge) {
                 continue;
             }
-
-            if (vidx1 == tria(0)) {
-                tria(0) = vidx0;
-            } else if (vidx1 == tria(1)) {
-                tria(1) = vidx0;
-            } else if (vidx1 == tria(2)) {
-                tria(2) = vidx0;
+            bool is_best = true;
+            for (int end : {std::get<1>(edge), std::get<2>(edge)}) {
+                for (int nb : neighbors[end]) {
+                    if (best[nb] < edge) {
+                        is_best = false;
+                    }
+                }
             }
-            vert_to_triangles[vidx0].insert(tidx);
+            selected[vidx] = is_best;
         }
-
-        // update vertex vidx0 to vbar
-        mesh->vertices_[vidx0] = vbars[edge];
-        Qs[vidx0] += Qs[vidx1];
-        if (has_vert_normal) {
-            mesh->vertex_normals_[vidx0] = 0.5 * (mesh->vertex_normals_[vidx0] +
-                                                  mesh->vertex_normals_[vidx1]);
+        std::vector<size_t> vertex_ids = utility::NonZeroIndices(selected);
+        if (vertex_ids.empty()) {
+            break;
         }
-        if (has_vert_color) {
-            mesh->vertex_colors_[vidx0] = 0.5 * (mesh->vertex_colors_[vidx0] +
-                                                 mesh->vertex_colors_[vidx1]);
+        std::vector<EdgeCollapse> collapses(vertex_ids.size());
+        std::vector<int> num_collapsed(vertex_ids.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(vertex_ids.size()); ++i) {
+            const KeyedEdge& edge = best[vertex_ids[i]];
+            collapses[i] =
+                    ComputeCollapse(std::get<1>(edge), std::get<2>(edge));
         }
-        vertices_deleted[vidx1] = true;
-
-        // Update edge costs for all triangles connecting to vidx0
-        for (const auto& tidx : vert_to_triangles[vidx0]) {
-            if (triangles_deleted[tidx]) {
-                continue;
-            }
-            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            if (tria(0) == vidx0 || tria(1) == vidx0) {
-                AddEdge(tria(0), tria(1), true);
-            }
-            if (tria(1) == vidx0 || tria(2) == vidx0) {
-                AddEdge(tria(1), tria(2), true);
-            }
-            if (tria(2) == vidx0 || tria(0) == vidx0) {
-                AddEdge(tria(2), tria(0), true);
+        std::sort(collapses.begin(), collapses.end(),
+                  [](const EdgeCollapse& a, const EdgeCollapse& b) {
+                      return a.cost_ < b.cost_;
+                  });
+
+        // Only the cheapest collapses needed to reach the target are applied
+        int num_remaining = n_triangles_;
+        size_t num_collapses = 0;
+        while (num_collapses < collapses.size() &&
+               num_remaining > target_number_of_triangles) {
+            num_remaining -= NumCollapsedTriangles(collapses[num_collapses]);
+            num_collapses++;
+        }
+        for (size_t i = 0; i < num_collapses; ++i) {
+            for (int end : {collapses[i].vidx0_, collapses[i].vidx1_}) {
+                dirty[end] = 1;
+                for (int nb : neighbors[end]) {
+                    dirty[nb] = 1;
+                }
             }
         }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(num_collapses); ++i) {
+            num_collapsed[i] = Collapse(collapses[i]);
+        }
+        n_triangles_ -= std::accumulate(num_collapsed.begin(),
+                                        num_collapsed.end(), 0);
     }
+}
 
+void QuadricDecimation::Compact() {
     // Apply changes to the triangle mesh
     int next_free = 0;
-    std::unordered_map<int, int> vert_remapping;
-    for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
-        if (!vertices_deleted[idx]) {
-            vert_remapping[int(idx)] = next_free;
-            mesh->vertices_[next_free] = mesh->vertices_[idx];
-            if (has_vert_normal) {
-                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+    std::vector<int> vert_remapping(mesh_.vertices_.size(), -1);
+    for (size_t idx = 0; idx < mesh_.vertices_.size(); ++idx) {
+        if (!vertices_deleted_[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh_.vertices_[next_free] = mesh_.vertices_[idx];
+            if (has_vert_normal_) {
+                mesh_.vertex_normals_[next_free] = mesh_.vertex_normals_[idx];
             }
-            if (has_vert_color) {
-                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            if (has_vert_color_) {
+                mesh_.vertex_colors_[next_free] = mesh_.vertex_colors_[idx];
             }
             next_free++;
         }
     }
-    mesh->vertices_.resize(next_free);
-    if (has_vert_normal) {
-        mesh->vertex_normals_.resize(next_free);
+    mesh_.vertices_.resize(next_free);
+    if (has_vert_normal_) {
+        mesh_.vertex_normals_.resize(next_free);
     }
-    if (has_vert_color) {
-        mesh->vertex_colors_.resize(next_free);
+    if (has_vert_color_) {
+        mesh_.vertex_colors_.resize(next_free);
     }
 
     next_free = 0;
-    for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
-        if (!triangles_deleted[idx]) {
-            Eigen::Vector3i tria = mesh->triangles_[idx];
-            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
-            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
-            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
+    for (size_t idx = 0; idx < mesh_.triangles_.size(); ++idx) {
+        if (!triangles_deleted_[idx]) {
+            Eigen::Vector3i tria = mesh_.triangles_[idx];
+            mesh_.triangles_[next_free](0) = vert_remapping[tria(0)];
+            mesh_.triangles_[next_free](1) = vert_remapping[tria(1)];
+            mesh_.triangles_[next_free](2) = vert_remapping[tria(2)];
             next_free++;
         }
     }
-    mesh->triangles_.resize(next_free);
+    mesh_.triangles_.resize(next_free);
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
+        int target_number_of_triangles, bool use_independent_sets) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
+                "that are not handled in this function");
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    QuadricDecimation decimation(*mesh);
+    if (use_independent_sets) {
+        decimation.SimplifyIndependentSets(target_number_of_triangles);
+    } else {
+        decimation.SimplifyGreedy(target_number_of_triangles);
+    }
+    decimation.Compact();
 
     if (HasTriangleNormals()) {
         mesh->ComputeTriangleNormals();
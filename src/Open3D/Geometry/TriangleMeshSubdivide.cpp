@@ -27,14 +27,169 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
 
+#include "Open3D/Geometry/VertexAdjacency.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Undirected edges of a list of triangles, built by sorting the edge keys of
+/// all triangle corners in parallel. Corner 3 * t + k of triangle t stands
+/// for its edge from vertex k to vertex (k + 1) % 3. Edges are numbered in
+/// the order of their first corner, which is the order in which a loop over
+/// the triangles meets them.
+class EdgeTable {
+public:
+    explicit EdgeTable(const std::vector<Eigen::Vector3i> &triangles);
+
+public:
+    size_t NumEdges() const { return edges_.size(); }
+    /// Returns the index of the edge (vidx0, vidx1), or -1 if there is none.
+    int FindEdge(int vidx0, int vidx1) const {
+        uint64_t key = EdgeKey(vidx0, vidx1);
+        auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+        if (it == keys_.end() || *it != key) {
+            return -1;
+        }
+        return key_edges_[it - keys_.begin()];
+    }
+    /// Returns the number of distinct triangles adjacent to edge \p e.
+    int NumTriangles(int e) const {
+        int num_triangles = 0;
+        for (size_t i = offsets_[e]; i < offsets_[e + 1]; ++i) {
+            if (i == offsets_[e] || corners_[i] / 3 != corners_[i - 1] / 3) {
+                num_triangles++;
+            }
+        }
+        return num_triangles;
+    }
+
+    static uint64_t EdgeKey(int vidx0, int vidx1) {
+        return (uint64_t(std::min(vidx0, vidx1)) << 32) |
+               uint64_t(std::max(vidx0, vidx1));
+    }
+
+public:
+    /// Vertices of every edge, smaller index first.
+    std::vector<Eigen::Vector2i> edges_;
+    /// Edge of every triangle corner.
+    std::vector<int> corner_edges_;
+    /// The corners of edge e are corners_[offsets_[e]] ...
+    /// corners_[offsets_[e + 1] - 1], in increasing order.
+    std::vector<size_t> offsets_;
+    std::vector<int> corners_;
+    /// Sorted edge keys, and the edge of every key.
+    std::vector<uint64_t> keys_;
+    std::vector<int> key_edges_;
+};
+
+EdgeTable::EdgeTable(const std::vector<Eigen::Vector3i> &triangles) {
+    int num_corners = int(3 * triangles.size());
+    std::vector<std::pair<uint64_t, int>> entries(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_corners; ++c) {
+        const Eigen::Vector3i &triangle = triangles[c / 3];
+        entries[c] = std::make_pair(
+                EdgeKey(triangle(c % 3), triangle((c + 1) % 3)), c);
+    }
+    utility::ParallelSort(entries);
+    std::vector<char> is_start(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_corners; ++i) {
+        is_start[i] = i == 0 || entries[i].first != entries[i - 1].first;
+    }
+    std::vector<size_t> starts = utility::NonZeroIndices(is_start);
+    starts.push_back(num_corners);
+    int num_edges = int(starts.size()) - 1;
+
+    // Number the edges by their first corner
+    std::vector<char> is_first(num_corners, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int s = 0; s < num_edges; ++s) {
+        is_first[entries[starts[s]].second] = 1;
+    }
+    std::vector<size_t> first_corners = utility::NonZeroIndices(is_first);
+    std::vector<int> corner_rank(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < num_edges; ++e) {
+        corner_rank[first_corners[e]] = e;
+    }
+
+    edges_.resize(num_edges);
+    corner_edges_.resize(num_corners);
+    offsets_.assign(num_edges + 1, 0);
+    corners_.resize(num_corners);
+    keys_.resize(num_edges);
+    key_edges_.resize(num_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int s = 0; s < num_edges; ++s) {
+        int e = corner_rank[entries[starts[s]].second];
+        uint64_t key = entries[starts[s]].first;
+        keys_[s] = key;
+        key_edges_[s] = e;
+        edges_[e] = Eigen::Vector2i(int(key >> 32), int(key & 0xffffffff));
+        offsets_[e + 1] = starts[s + 1] - starts[s];
+        for (size_t i = starts[s]; i < starts[s + 1]; ++i) {
+            corner_edges_[entries[i].second] = e;
+        }
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int s = 0; s < num_edges; ++s) {
+        size_t offset = offsets_[key_edges_[s]];
+        for (size_t i = starts[s]; i < starts[s + 1]; ++i) {
+            corners_[offset + i - starts[s]] = entries[i].second;
+        }
+    }
+}
+
+/// Splits every triangle into four. The vertex on edge e of \p table has
+/// index \p num_vertices + e.
+std::vector<Eigen::Vector3i> SplitTriangles(
+        const std::vector<Eigen::Vector3i> &triangles,
+        const EdgeTable &table,
+        int num_vertices) {
+    std::vector<Eigen::Vector3i> new_triangles(4 * triangles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        const auto &triangle = triangles[tidx];
+        int vidx0 = triangle(0);
+        int vidx1 = triangle(1);
+        int vidx2 = triangle(2);
+        int vidx01 = num_vertices + table.corner_edges_[3 * tidx + 0];
+        int vidx12 = num_vertices + table.corner_edges_[3 * tidx + 1];
+        int vidx20 = num_vertices + table.corner_edges_[3 * tidx + 2];
+        new_triangles[tidx * 4 + 0] = Eigen::Vector3i(vidx0, vidx01, vidx20);
+        new_triangles[tidx * 4 + 1] = Eigen::Vector3i(vidx01, vidx1, vidx12);
+        new_triangles[tidx * 4 + 2] = Eigen::Vector3i(vidx12, vidx2, vidx20);
+        new_triangles[tidx * 4 + 3] = Eigen::Vector3i(vidx01, vidx12, vidx20);
+    }
+    return new_triangles;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -51,59 +206,38 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen::hash<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen::hash<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
+        EdgeTable table(mesh->triangles_);
+        int num_vertices = int(mesh->vertices_.size());
+        int num_edges = int(table.NumEdges());
+        mesh->vertices_.resize(num_vertices + num_edges);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(num_vertices + num_edges);
         }
-        mesh->triangles_ = new_triangles;
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(num_vertices + num_edges);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int e = 0; e < num_edges; ++e) {
+            int min = table.edges_[e](0);
+            int max = table.edges_[e](1);
+            mesh->vertices_[num_vertices + e] =
+                    0.5 * (mesh->vertices_[min] + mesh->vertices_[max]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[num_vertices + e] =
+                        0.5 * (mesh->vertex_normals_[min] +
+                               mesh->vertex_normals_[max]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[num_vertices + e] =
+                        0.5 * (mesh->vertex_colors_[min] +
+                               mesh->vertex_colors_[max]);
+            }
+        }
+        mesh->triangles_ =
+                SplitTriangles(mesh->triangles_, table, num_vertices);
     }
 
     if (HasTriangleNormals()) {
@@ -120,89 +254,115 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
-
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
+    auto old_mesh = std::make_shared<TriangleMesh>();
+    old_mesh->vertices_ = vertices_;
+    old_mesh->vertex_colors_ = vertex_colors_;
+    old_mesh->vertex_normals_ = vertex_normals_;
+    old_mesh->triangles_ = triangles_;
 
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        EdgeTable table(old_mesh->triangles_);
+        VertexAdjacency adjacency;
+        adjacency.ComputeFromTriangles(old_mesh->vertices_.size(),
+                                       old_mesh->triangles_);
+        int num_vertices = int(old_mesh->vertices_.size());
+        int num_edges = int(table.NumEdges());
+        std::vector<int> num_edge_triangles(num_edges);
+        bool is_manifold = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(&& : is_manifold)
+#endif
+        for (int e = 0; e < num_edges; ++e) {
+            num_edge_triangles[e] = table.NumTriangles(e);
+            is_manifold = is_manifold && num_edge_triangles[e] <= 2;
         }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+        if (iter == 0 && !is_manifold) {
+            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
         }
 
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
+        auto new_mesh = std::make_shared<TriangleMesh>();
+        new_mesh->vertices_.resize(num_vertices + num_edges);
         if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
+            new_mesh->vertex_normals_.resize(num_vertices + num_edges);
         }
         if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
+            new_mesh->vertex_colors_.resize(num_vertices + num_edges);
         }
 
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+        // Vertex points. Vertices on two boundary edges only use the
+        // boundary neighbours.
+        bool has_boundary_fan = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : has_boundary_fan)
+#endif
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            const int *nbs = adjacency.NeighborIndices(vidx);
+            int num_nbs = adjacency.NumNeighbors(vidx);
+            std::vector<int> boundary_nbs;
+            for (int k = 0; k < num_nbs; ++k) {
+                int e = table.FindEdge(vidx, nbs[k]);
+                if (num_edge_triangles[e] == 1) {
+                    boundary_nbs.push_back(nbs[k]);
+                }
+            }
+            // in manifold meshes this should not happen
+            has_boundary_fan = has_boundary_fan || boundary_nbs.size() > 2;
+
+            double beta, alpha;
+            if (boundary_nbs.size() >= 2) {
+                beta = 1. / 8.;
+                alpha = 1. - boundary_nbs.size() * beta;
+                nbs = boundary_nbs.data();
+                num_nbs = int(boundary_nbs.size());
+            } else if (num_nbs == 0) {
+                beta = 0.;
+                alpha = 1.;
+            } else if (num_nbs == 3) {
+                beta = 3. / 16.;
+                alpha = 1. - num_nbs * beta;
+            } else {
+                beta = 3. / (8. * num_nbs);
+                alpha = 1. - num_nbs * beta;
+            }
+
+            new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
+                new_mesh->vertex_normals_[vidx] =
+                        alpha * old_mesh->vertex_normals_[vidx];
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
-            }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
+                new_mesh->vertex_colors_[vidx] =
+                        alpha * old_mesh->vertex_colors_[vidx];
             }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
+            for (int k = 0; k < num_nbs; ++k) {
+                int nb = nbs[k];
+                new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+                if (has_vert_normal) {
+                    new_mesh->vertex_normals_[vidx] +=
+                            beta * old_mesh->vertex_normals_[nb];
+                }
+                if (has_vert_color) {
+                    new_mesh->vertex_colors_[vidx] +=
+                            beta * old_mesh->vertex_colors_[nb];
+                }
             }
         }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
+        if (has_boundary_fan) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
+        }
+
+        // Edge points
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int e = 0; e < num_edges; ++e) {
+            int vidx0 = table.edges_[e](0);
+            int vidx1 = table.edges_[e](1);
             Eigen::Vector3d new_vert =
                     old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
             Eigen::Vector3d new_normal;
@@ -216,8 +376,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                             old_mesh->vertex_colors_[vidx1];
             }
 
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
+            if (num_edge_triangles[e] < 2) {
                 new_vert *= 0.5;
                 if (has_vert_normal) {
                     new_normal *= 0.5;
@@ -233,10 +392,15 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 if (has_vert_color) {
                     new_color *= 3. / 8.;
                 }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
+                double scale = 1. / (4. * num_edge_triangles[e]);
+                for (size_t i = table.offsets_[e]; i < table.offsets_[e + 1];
+                     ++i) {
+                    int tidx = table.corners_[i] / 3;
+                    if (i > table.offsets_[e] &&
+                        table.corners_[i - 1] / 3 == tidx) {
+                        continue;
+                    }
+                    const auto &tria = old_mesh->triangles_[tidx];
                     int vidx2 =
                             (tria(0) != vidx0 && tria(0) != vidx1)
                                     ? tria(0)
@@ -253,120 +417,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 }
             }
 
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
+            new_mesh->vertices_[num_vertices + e] = new_vert;
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
+                new_mesh->vertex_normals_[num_vertices + e] = new_normal;
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
+                new_mesh->vertex_colors_[num_vertices + e] = new_color;
             }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
-    auto old_mesh = std::make_shared<TriangleMesh>();
-    old_mesh->vertices_ = vertices_;
-    old_mesh->vertex_colors_ = vertex_colors_;
-    old_mesh->vertex_normals_ = vertex_normals_;
-    old_mesh->triangles_ = triangles_;
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
-        auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
-        }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
-
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
-        }
-
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
         }
 
+        new_mesh->triangles_ =
+                SplitTriangles(old_mesh->triangles_, table, num_vertices);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (HasTriangleNormals()) {
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VertexAdjacency.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+VertexAdjacency::VertexAdjacency(const TriangleMesh &mesh) {
+    ComputeFromTriangleMesh(mesh);
+}
+
+bool VertexAdjacency::ComputeFromTriangleMesh(const TriangleMesh &mesh) {
+    if (mesh.HasAdjacencyList()) {
+        return ComputeFromAdjacencyList(mesh.adjacency_list_);
+    }
+    return ComputeFromTriangles(mesh.vertices_.size(), mesh.triangles_);
+}
+
+bool VertexAdjacency::ComputeFromTriangles(
+        size_t num_vertices, const std::vector<Eigen::Vector3i> &triangles) {
+    Clear();
+    int num_triangles = int(triangles.size());
+
+    // Both directions of every triangle edge, keyed (source, target) so that
+    // sorting groups the edges by source vertex.
+    std::vector<uint64_t> edges(6 * triangles.size());
+    bool valid = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(&& : valid)
+#endif
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        for (int k = 0; k < 3; ++k) {
+            if (triangle(k) < 0 || size_t(triangle(k)) >= num_vertices) {
+                valid = false;
+            }
+            uint64_t a = uint32_t(triangle(k));
+            uint64_t b = uint32_t(triangle((k + 1) % 3));
+            edges[6 * tidx + 2 * k] = (a << 32) | b;
+            edges[6 * tidx + 2 * k + 1] = (b << 32) | a;
+        }
+    }
+    if (!valid) {
+        utility::LogWarning(
+                "[VertexAdjacency] triangles reference vertices out of "
+                "range.");
+        return false;
+    }
+    utility::ParallelSort(edges);
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    offsets_.resize(num_vertices + 1);
+    indices_.resize(edges.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(num_vertices); ++vidx) {
+        offsets_[vidx] = std::lower_bound(edges.begin(), edges.end(),
+                                          uint64_t(vidx) << 32) -
+                         edges.begin();
+    }
+    offsets_[num_vertices] = edges.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(edges.size()); ++i) {
+        indices_[i] = int(edges[i] & 0xffffffff);
+    }
+    return true;
+}
+
+bool VertexAdjacency::ComputeFromAdjacencyList(
+        const std::vector<std::unordered_set<int>> &adjacency_list) {
+    Clear();
+    int num_vertices = int(adjacency_list.size());
+    offsets_.resize(num_vertices + 1, 0);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        offsets_[vidx + 1] = offsets_[vidx] + adjacency_list[vidx].size();
+    }
+    indices_.resize(offsets_.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        auto begin = indices_.begin() + offsets_[vidx];
+        std::copy(adjacency_list[vidx].begin(), adjacency_list[vidx].end(),
+                  begin);
+        std::sort(begin, indices_.begin() + offsets_[vidx + 1]);
+    }
+    return true;
+}
+
+std::vector<std::unordered_set<int>> VertexAdjacency::ToAdjacencyList()
+        const {
+    int num_vertices = int(NumVertices());
+    std::vector<std::unordered_set<int>> adjacency_list(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        adjacency_list[vidx].insert(NeighborIndices(vidx),
+                                    NeighborIndices(vidx) + NumNeighbors(vidx));
+    }
+    return adjacency_list;
+}
+
+void VertexAdjacency::Clear() {
+    offsets_.clear();
+    indices_.clear();
+}
+
+}  // namespace geometry
+}  // namespace open3d
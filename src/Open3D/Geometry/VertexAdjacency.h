@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <unordered_set>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class VertexAdjacency
+///
+/// \brief Vertex adjacency of a triangle mesh, stored in compressed sparse
+/// row (CSR) form.
+///
+/// The neighbors of vertex i are indices_[offsets_[i]] ...
+/// indices_[offsets_[i + 1] - 1], sorted by increasing index. The structure
+/// is built in parallel by sorting the directed edge list of the triangles
+/// and removing duplicates, and is used by the mesh filters in place of
+/// TriangleMesh::adjacency_list_, which is kept as a compatibility view.
+class VertexAdjacency {
+public:
+    /// \brief Default Constructor.
+    VertexAdjacency() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The triangle mesh whose adjacency is computed.
+    explicit VertexAdjacency(const TriangleMesh &mesh);
+    ~VertexAdjacency() {}
+
+public:
+    /// Computes the adjacency of \p mesh. If the mesh has an adjacency list
+    /// it is used as is, otherwise the adjacency is computed from the
+    /// triangles.
+    ///
+    /// \param mesh The triangle mesh whose adjacency is computed.
+    bool ComputeFromTriangleMesh(const TriangleMesh &mesh);
+    /// Computes the adjacency induced by the edges of \p triangles.
+    ///
+    /// \param num_vertices Number of vertices (rows) of the adjacency.
+    /// \param triangles Triangles, each indexing three vertices.
+    bool ComputeFromTriangles(size_t num_vertices,
+                              const std::vector<Eigen::Vector3i> &triangles);
+    /// Converts a set based adjacency list to CSR form.
+    ///
+    /// \param adjacency_list The set adjacency_list[i] contains the indices
+    /// of the neighbors of vertex i.
+    bool ComputeFromAdjacencyList(
+            const std::vector<std::unordered_set<int>> &adjacency_list);
+    /// Returns the adjacency as a list of sets, the layout of
+    /// TriangleMesh::adjacency_list_.
+    std::vector<std::unordered_set<int>> ToAdjacencyList() const;
+    /// Removes all rows.
+    void Clear();
+    /// Returns the number of vertices (rows) of the adjacency.
+    size_t NumVertices() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the number of neighbors of vertex \p i.
+    int NumNeighbors(size_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Returns a pointer to the neighbor indices of vertex \p i.
+    const int *NeighborIndices(size_t i) const {
+        return indices_.data() + offsets_[i];
+    }
+
+public:
+    /// Row offsets, of size NumVertices() + 1.
+    std::vector<size_t> offsets_;
+    /// Neighbor indices of all vertices, concatenated.
+    std::vector<int> indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
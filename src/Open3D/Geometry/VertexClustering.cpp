@@ -0,0 +1,316 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VertexClustering.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+const int kKeyBits = 21;
+const int64_t kKeyOffset = int64_t(1) << (kKeyBits - 1);
+
+/// Splits the sorted \p keys into runs of equal keys, and returns the start
+/// of every run followed by keys.size().
+template <typename T, typename Equal>
+std::vector<size_t> SegmentStarts(const std::vector<T> &keys, Equal equal) {
+    std::vector<char> is_start(keys.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(keys.size()); ++i) {
+        is_start[i] = i == 0 || !equal(keys[i - 1], keys[i]);
+    }
+    std::vector<size_t> starts = utility::NonZeroIndices(is_start);
+    starts.push_back(keys.size());
+    return starts;
+}
+
+}  // unnamed namespace
+
+VertexClustering::VertexClustering(
+        double voxel_size,
+        MeshBase::SimplificationContraction contraction /* = Average */,
+        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero() */)
+    : voxel_size_(voxel_size), contraction_(contraction), origin_(origin) {
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VertexClustering] voxel_size <= 0.0");
+    }
+}
+
+void VertexClustering::AddMesh(const TriangleMesh &mesh) {
+    if (!has_meshes_) {
+        has_vertex_normals_ = mesh.HasVertexNormals();
+        has_vertex_colors_ = mesh.HasVertexColors();
+        has_triangle_normals_ = mesh.HasTriangleNormals();
+        has_meshes_ = true;
+    } else {
+        has_vertex_normals_ = has_vertex_normals_ && mesh.HasVertexNormals();
+        has_vertex_colors_ = has_vertex_colors_ && mesh.HasVertexColors();
+        has_triangle_normals_ =
+                has_triangle_normals_ && mesh.HasTriangleNormals();
+    }
+    int num_vertices = int(mesh.vertices_.size());
+
+    // Sort the vertices by voxel key
+    typedef std::pair<uint64_t, int> KeyVertex;
+    std::vector<KeyVertex> keys(num_vertices);
+    bool in_range = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(&& : in_range)
+#endif
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        Eigen::Vector3d ref_coord =
+                (mesh.vertices_[vidx] - origin_) / voxel_size_;
+        ref_coord = ref_coord.array().floor();
+        // Also false for non-finite coordinates
+        if (!(ref_coord.minCoeff() >= -kKeyOffset &&
+              ref_coord.maxCoeff() < kKeyOffset)) {
+            in_range = false;
+            continue;
+        }
+        uint64_t key = 0;
+        for (int d = 0; d < 3; ++d) {
+            key = (key << kKeyBits) |
+                  uint64_t(int64_t(ref_coord(d)) + kKeyOffset);
+        }
+        keys[vidx] = KeyVertex(key, vidx);
+    }
+    if (!in_range) {
+        utility::LogError(
+                "[VertexClustering] A vertex is more than 2^20 voxels away "
+                "from the origin, or not finite.");
+    }
+    utility::ParallelSort(keys);
+    std::vector<size_t> starts = SegmentStarts(
+            keys, [](const KeyVertex &a, const KeyVertex &b) {
+                return a.first == b.first;
+            });
+    int num_voxels = int(starts.size()) - 1;
+
+    // New clusters are numbered by their first vertex, so that the result
+    // does not depend on the key order
+    std::vector<int> voxel_order(num_voxels);
+    for (int i = 0; i < num_voxels; ++i) {
+        voxel_order[i] = i;
+    }
+    std::sort(voxel_order.begin(), voxel_order.end(), [&](int a, int b) {
+        return keys[starts[a]].second < keys[starts[b]].second;
+    });
+    std::vector<int> voxel_cluster(num_voxels);
+    for (int i : voxel_order) {
+        auto inserted = cluster_index_.emplace(keys[starts[i]].first,
+                                               int(cluster_index_.size()));
+        voxel_cluster[i] = inserted.first->second;
+    }
+    size_t num_clusters = cluster_index_.size();
+    counts_.resize(num_clusters, 0);
+    vertex_sums_.resize(num_clusters, Eigen::Vector3d::Zero());
+    if (has_vertex_normals_) {
+        normal_sums_.resize(num_clusters, Eigen::Vector3d::Zero());
+    }
+    if (has_vertex_colors_) {
+        color_sums_.resize(num_clusters, Eigen::Vector3d::Zero());
+    }
+
+    // Every voxel of the mesh is a distinct cluster, so the sums of the
+    // voxels are accumulated in parallel
+    std::vector<int> vertex_cluster(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_voxels; ++i) {
+        int cidx = voxel_cluster[i];
+        for (size_t k = starts[i]; k < starts[i + 1]; ++k) {
+            int vidx = keys[k].second;
+            vertex_cluster[vidx] = cidx;
+            vertex_sums_[cidx] += mesh.vertices_[vidx];
+            if (has_vertex_normals_) {
+                normal_sums_[cidx] += mesh.vertex_normals_[vidx];
+            }
+            if (has_vertex_colors_) {
+                color_sums_[cidx] += mesh.vertex_colors_[vidx];
+            }
+        }
+        counts_[cidx] += int(starts[i + 1] - starts[i]);
+    }
+
+    int num_triangles = int(mesh.triangles_.size());
+    if (contraction_ == MeshBase::SimplificationContraction::Quadric) {
+        quadrics_.resize(num_clusters, Eigen::Matrix4d::Zero());
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                triangle_quadrics(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            Eigen::Vector4d plane = mesh.GetTrianglePlane(tidx);
+            triangle_quadrics[tidx] = mesh.GetTriangleArea(tidx) * plane *
+                                      plane.transpose();
+        }
+        // Every corner adds the quadric of its triangle to the cluster of
+        // its vertex. The corners are sorted by cluster and each run is
+        // summed separately.
+        std::vector<uint64_t> corners(3 * size_t(num_triangles));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            for (int k = 0; k < 3; ++k) {
+                int cidx = vertex_cluster[mesh.triangles_[tidx](k)];
+                corners[3 * size_t(tidx) + k] =
+                        (uint64_t(cidx) << 32) | uint64_t(tidx);
+            }
+        }
+        utility::ParallelSort(corners);
+        std::vector<size_t> corner_starts =
+                SegmentStarts(corners, [](uint64_t a, uint64_t b) {
+                    return (a >> 32) == (b >> 32);
+                });
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(corner_starts.size()) - 1; ++i) {
+            int cidx = int(corners[corner_starts[i]] >> 32);
+            for (size_t k = corner_starts[i]; k < corner_starts[i + 1]; ++k) {
+                quadrics_[cidx] +=
+                        triangle_quadrics[corners[k] & 0xffffffff];
+            }
+        }
+    }
+
+    // Only triangles with vertices in three distinct clusters are kept
+    std::vector<Eigen::Vector3i> triangles(num_triangles);
+    std::vector<char> keep(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        Eigen::Vector3i triangle(vertex_cluster[mesh.triangles_[tidx](0)],
+                                 vertex_cluster[mesh.triangles_[tidx](1)],
+                                 vertex_cluster[mesh.triangles_[tidx](2)]);
+        keep[tidx] = triangle(0) != triangle(1) &&
+                     triangle(0) != triangle(2) && triangle(1) != triangle(2);
+        // Note: there can be still double faces with different orientation
+        // The user has to clean up manually
+        int min_k;
+        triangle.minCoeff(&min_k);
+        triangles[tidx] = Eigen::Vector3i(triangle((min_k + 0) % 3),
+                                          triangle((min_k + 1) % 3),
+                                          triangle((min_k + 2) % 3));
+    }
+    for (size_t tidx : utility::NonZeroIndices(keep)) {
+        triangles_.push_back(triangles[tidx]);
+    }
+}
+
+std::shared_ptr<TriangleMesh> VertexClustering::ExtractTriangleMesh() const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    int num_clusters = int(counts_.size());
+    mesh->vertices_.resize(num_clusters);
+    if (has_vertex_normals_) {
+        mesh->vertex_normals_.resize(num_clusters);
+    }
+    if (has_vertex_colors_) {
+        mesh->vertex_colors_.resize(num_clusters);
+    }
+    bool use_quadrics =
+            contraction_ == MeshBase::SimplificationContraction::Quadric;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int cidx = 0; cidx < num_clusters; ++cidx) {
+        mesh->vertices_[cidx] = vertex_sums_[cidx] / double(counts_[cidx]);
+        if (use_quadrics) {
+            Eigen::Matrix3d A = quadrics_[cidx].topLeftCorner<3, 3>();
+            Eigen::Vector3d b = quadrics_[cidx].topRightCorner<3, 1>();
+            if (std::fabs(A.determinant()) > 1e-4) {
+                mesh->vertices_[cidx] = -A.ldlt().solve(b);
+            }
+        }
+        if (has_vertex_normals_) {
+            mesh->vertex_normals_[cidx] =
+                    normal_sums_[cidx] / double(counts_[cidx]);
+        }
+        if (has_vertex_colors_) {
+            mesh->vertex_colors_[cidx] =
+                    color_sums_[cidx] / double(counts_[cidx]);
+        }
+    }
+
+    typedef std::tuple<int, int, int> Index3;
+    std::vector<Index3> triangles(triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        triangles[tidx] = Index3(triangles_[tidx](0), triangles_[tidx](1),
+                                 triangles_[tidx](2));
+    }
+    utility::ParallelSort(triangles);
+    triangles.erase(std::unique(triangles.begin(), triangles.end()),
+                    triangles.end());
+    mesh->triangles_.resize(triangles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        mesh->triangles_[tidx] = Eigen::Vector3i(std::get<0>(triangles[tidx]),
+                                                 std::get<1>(triangles[tidx]),
+                                                 std::get<2>(triangles[tidx]));
+    }
+    if (has_triangle_normals_) {
+        mesh->ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
+void VertexClustering::Reset() {
+    has_meshes_ = false;
+    has_vertex_normals_ = false;
+    has_vertex_colors_ = false;
+    has_triangle_normals_ = false;
+    cluster_index_.clear();
+    counts_.clear();
+    vertex_sums_.clear();
+    normal_sums_.clear();
+    color_sums_.clear();
+    quadrics_.clear();
+    triangles_.clear();
+}
+
+}  // namespace geometry
+}  // namespace open3d
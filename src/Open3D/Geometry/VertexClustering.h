@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Geometry/MeshBase.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class VertexClustering
+///
+/// \brief Vertex clustering simplification of a mesh that arrives in chunks.
+///
+/// All vertices falling into the same voxel of a fixed grid are merged into
+/// one vertex. Meshes are added one after the other, e.g. the chunks of a
+/// TSDF extraction, and only per-voxel sums are kept, so vertices that are
+/// duplicated along the chunk borders are merged as well. Adding a single
+/// mesh and extracting the result is TriangleMesh::SimplifyVertexClustering.
+///
+/// Voxels are identified by a 64 bit key that packs 21 bits per axis, which
+/// limits the grid to 2^20 voxels on each side of the origin.
+class VertexClustering {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Size of the voxels within which vertices are pooled.
+    /// \param contraction Method to aggregate the vertex positions. Average
+    /// computes a simple average, Quadric minimizes the distance to the
+    /// adjacent planes.
+    /// \param origin Corner of the voxel with index (0, 0, 0).
+    VertexClustering(double voxel_size,
+                     MeshBase::SimplificationContraction contraction =
+                             MeshBase::SimplificationContraction::Average,
+                     const Eigen::Vector3d &origin = Eigen::Vector3d::Zero());
+    ~VertexClustering() {}
+
+public:
+    /// Adds the vertices and triangles of \p mesh to the clusters. Vertex
+    /// normals, vertex colors and triangle normals are kept only if every
+    /// added mesh has them.
+    ///
+    /// \param mesh The mesh, or chunk of a mesh, to add.
+    void AddMesh(const TriangleMesh &mesh);
+    /// Returns the simplified mesh of everything added so far. It has one
+    /// vertex per occupied voxel, and every triangle whose vertices fall
+    /// into three distinct voxels, without duplicates. The result can be a
+    /// non-manifold mesh.
+    std::shared_ptr<TriangleMesh> ExtractTriangleMesh() const;
+    /// Removes all clusters and triangles.
+    void Reset();
+    /// Returns the number of occupied voxels.
+    size_t NumClusters() const { return counts_.size(); }
+
+public:
+    double voxel_size_;
+    MeshBase::SimplificationContraction contraction_;
+    Eigen::Vector3d origin_;
+
+private:
+    bool has_meshes_ = false;
+    bool has_vertex_normals_ = false;
+    bool has_vertex_colors_ = false;
+    bool has_triangle_normals_ = false;
+    /// Cluster index of every occupied voxel, by packed voxel key.
+    std::unordered_map<uint64_t, int> cluster_index_;
+    std::vector<int> counts_;
+    std::vector<Eigen::Vector3d> vertex_sums_;
+    std::vector<Eigen::Vector3d> normal_sums_;
+    std::vector<Eigen::Vector3d> color_sums_;
+    /// Area weighted sum of the plane quadrics of the triangles adjacent to
+    /// the vertices of each cluster, in homogeneous form.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> quadrics_;
+    /// Triangles between clusters, starting at their smallest index.
+    std::vector<Eigen::Vector3i> triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshLOD.h"
+
+namespace open3d {
+namespace io {
+
+/// The general entrance for reading a TriangleMeshLOD from a file
+/// \return If the read function is successful.
+bool ReadTriangleMeshLOD(const std::string &filename,
+                         geometry::TriangleMeshLOD &lod);
+
+/// The general entrance for writing a TriangleMeshLOD to a file
+/// \return If the write function is successful.
+bool WriteTriangleMeshLOD(const std::string &filename,
+                          const geometry::TriangleMeshLOD &lod);
+
+/// Reads a single tile of a single level of a TriangleMeshLOD file, without
+/// reading the rest of the file.
+/// \return If the read function is successful.
+bool ReadTriangleMeshLODTile(const std::string &filename,
+                             size_t level,
+                             size_t tile,
+                             geometry::TriangleMesh &mesh);
+
+bool ReadTriangleMeshLODFromBIN(const std::string &filename,
+                                geometry::TriangleMeshLOD &lod);
+
+bool WriteTriangleMeshLODToBIN(const std::string &filename,
+                               const geometry::TriangleMeshLOD &lod);
+
+bool ReadTriangleMeshLODTileFromBIN(const std::string &filename,
+                                    size_t level,
+                                    size_t tile,
+                                    geometry::TriangleMesh &mesh);
+
+}  // namespace io
+}  // namespace open3d
@@ -24,10 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshLODIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 
@@ -72,6 +75,182 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+const char kLODMagic[8] = {'O', '3', 'D', 'L', 'O', 'D', '0', '1'};
+
+template <typename T>
+bool ReadArrayFromBINFile(FILE *file, T *data, size_t count) {
+    if (count > 0 && fread(data, sizeof(T), count, file) < count) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool WriteArrayToBINFile(FILE *file, const T *data, size_t count) {
+    if (count > 0 && fwrite(data, sizeof(T), count, file) < count) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+/// Fixed size part of a TriangleMeshLOD file. It is followed by the tile
+/// indices, the offsets of the tile meshes and the tile meshes.
+struct LODHeader {
+    uint32_t num_levels = 0;
+    uint32_t num_tiles = 0;
+    int32_t tile_depth = 0;
+    double origin[3] = {0, 0, 0};
+    double tile_size = 0;
+};
+
+const size_t kLODHeaderSize = sizeof(kLODMagic) + 3 * sizeof(uint32_t) +
+                              4 * sizeof(double);
+
+bool ReadLODHeaderFromBINFile(FILE *file, LODHeader &header) {
+    char magic[sizeof(kLODMagic)];
+    if (!ReadArrayFromBINFile(file, magic, sizeof(magic))) {
+        return false;
+    }
+    if (!std::equal(magic, magic + sizeof(magic), kLODMagic)) {
+        utility::LogWarning("Read BIN failed: not a TriangleMeshLOD file.");
+        return false;
+    }
+    return ReadArrayFromBINFile(file, &header.num_levels, 1) &&
+           ReadArrayFromBINFile(file, &header.num_tiles, 1) &&
+           ReadArrayFromBINFile(file, &header.tile_depth, 1) &&
+           ReadArrayFromBINFile(file, header.origin, 3) &&
+           ReadArrayFromBINFile(file, &header.tile_size, 1);
+}
+
+size_t GetTileMeshSize(const geometry::TriangleMesh &mesh) {
+    size_t num_vertices = mesh.vertices_.size();
+    size_t size = 3 * sizeof(uint32_t) + num_vertices * 3 * sizeof(float) +
+                  mesh.triangles_.size() * 3 * sizeof(uint32_t);
+    if (mesh.HasVertexNormals()) {
+        size += num_vertices * 3 * sizeof(float);
+    }
+    if (mesh.HasVertexColors()) {
+        size += num_vertices * 3 * sizeof(uint8_t);
+    }
+    return size;
+}
+
+/// Tile meshes store positions as floats relative to the tile \p corner,
+/// normals as floats and colors as bytes.
+bool ReadTileMeshFromBINFile(FILE *file,
+                             const Eigen::Vector3d &corner,
+                             geometry::TriangleMesh &mesh) {
+    uint32_t sizes[3];
+    if (!ReadArrayFromBINFile(file, sizes, 3)) {
+        return false;
+    }
+    size_t num_vertices = sizes[0];
+    size_t num_triangles = sizes[1];
+    std::vector<float> values(3 * num_vertices);
+    std::vector<uint8_t> colors(3 * num_vertices);
+    std::vector<uint32_t> triangles(3 * num_triangles);
+    mesh.Clear();
+    if (!ReadArrayFromBINFile(file, values.data(), values.size())) {
+        return false;
+    }
+    mesh.vertices_.resize(num_vertices);
+    for (size_t i = 0; i < num_vertices; i++) {
+        mesh.vertices_[i] =
+                corner + Eigen::Vector3f(values[3 * i], values[3 * i + 1],
+                                         values[3 * i + 2])
+                                 .cast<double>();
+    }
+    if (sizes[2] & 1) {
+        if (!ReadArrayFromBINFile(file, values.data(), values.size())) {
+            return false;
+        }
+        mesh.vertex_normals_.resize(num_vertices);
+        for (size_t i = 0; i < num_vertices; i++) {
+            mesh.vertex_normals_[i] =
+                    Eigen::Vector3f(values[3 * i], values[3 * i + 1],
+                                    values[3 * i + 2])
+                            .cast<double>();
+        }
+    }
+    if (sizes[2] & 2) {
+        if (!ReadArrayFromBINFile(file, colors.data(), colors.size())) {
+            return false;
+        }
+        mesh.vertex_colors_.resize(num_vertices);
+        for (size_t i = 0; i < num_vertices; i++) {
+            mesh.vertex_colors_[i] = Eigen::Vector3d(colors[3 * i],
+                                                     colors[3 * i + 1],
+                                                     colors[3 * i + 2]) /
+                                     255.0;
+        }
+    }
+    if (!ReadArrayFromBINFile(file, triangles.data(), triangles.size())) {
+        return false;
+    }
+    mesh.triangles_.resize(num_triangles);
+    for (size_t i = 0; i < num_triangles; i++) {
+        mesh.triangles_[i] = Eigen::Vector3i(int(triangles[3 * i]),
+                                             int(triangles[3 * i + 1]),
+                                             int(triangles[3 * i + 2]));
+    }
+    return true;
+}
+
+bool WriteTileMeshToBINFile(FILE *file,
+                            const Eigen::Vector3d &corner,
+                            const geometry::TriangleMesh &mesh) {
+    size_t num_vertices = mesh.vertices_.size();
+    uint32_t sizes[3] = {uint32_t(num_vertices),
+                         uint32_t(mesh.triangles_.size()),
+                         uint32_t((mesh.HasVertexNormals() ? 1 : 0) |
+                                  (mesh.HasVertexColors() ? 2 : 0))};
+    if (!WriteArrayToBINFile(file, sizes, 3)) {
+        return false;
+    }
+    std::vector<float> values(3 * num_vertices);
+    for (size_t i = 0; i < num_vertices; i++) {
+        Eigen::Vector3f::Map(&values[3 * i]) =
+                (mesh.vertices_[i] - corner).cast<float>();
+    }
+    if (!WriteArrayToBINFile(file, values.data(), values.size())) {
+        return false;
+    }
+    if (mesh.HasVertexNormals()) {
+        for (size_t i = 0; i < num_vertices; i++) {
+            Eigen::Vector3f::Map(&values[3 * i]) =
+                    mesh.vertex_normals_[i].cast<float>();
+        }
+        if (!WriteArrayToBINFile(file, values.data(), values.size())) {
+            return false;
+        }
+    }
+    if (mesh.HasVertexColors()) {
+        std::vector<uint8_t> colors(3 * num_vertices);
+        for (size_t i = 0; i < 3 * num_vertices; i++) {
+            double color = mesh.vertex_colors_[i / 3](i % 3);
+            colors[i] = uint8_t(
+                    std::round(std::min(std::max(color, 0.0), 1.0) * 255.0));
+        }
+        if (!WriteArrayToBINFile(file, colors.data(), colors.size())) {
+            return false;
+        }
+    }
+    std::vector<uint32_t> triangles(3 * mesh.triangles_.size());
+    for (size_t i = 0; i < triangles.size(); i++) {
+        triangles[i] = uint32_t(mesh.triangles_[i / 3](i % 3));
+    }
+    return WriteArrayToBINFile(file, triangles.data(), triangles.size());
+}
+
+Eigen::Vector3d GetTileCorner(const LODHeader &header,
+                              const Eigen::Vector3i &tile_index) {
+    return Eigen::Vector3d(header.origin[0], header.origin[1],
+                           header.origin[2]) +
+           tile_index.cast<double>() * header.tile_size;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +281,144 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadTriangleMeshLODFromBIN(const std::string &filename,
+                                geometry::TriangleMeshLOD &lod) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    lod.Clear();
+    LODHeader header;
+    bool success = ReadLODHeaderFromBINFile(fid, header);
+    std::vector<int32_t> tile_indices(3 * size_t(header.num_tiles));
+    std::vector<uint64_t> offsets(
+            size_t(header.num_levels) * header.num_tiles + 1);
+    success = success &&
+              ReadArrayFromBINFile(fid, tile_indices.data(),
+                                   tile_indices.size()) &&
+              ReadArrayFromBINFile(fid, offsets.data(), offsets.size());
+    if (success) {
+        lod.origin_ = Eigen::Vector3d(header.origin[0], header.origin[1],
+                                      header.origin[2]);
+        lod.tile_size_ = header.tile_size;
+        lod.tile_depth_ = header.tile_depth;
+        for (size_t t = 0; t < header.num_tiles; t++) {
+            lod.tile_indices_.push_back(
+                    Eigen::Vector3i(tile_indices[3 * t],
+                                    tile_indices[3 * t + 1],
+                                    tile_indices[3 * t + 2]));
+        }
+        lod.levels_.resize(header.num_levels);
+    }
+    // The tile meshes follow the offsets, level by level
+    for (size_t level = 0; success && level < header.num_levels; level++) {
+        for (size_t t = 0; success && t < header.num_tiles; t++) {
+            auto mesh = std::make_shared<geometry::TriangleMesh>();
+            success = ReadTileMeshFromBINFile(
+                    fid, GetTileCorner(header, lod.tile_indices_[t]), *mesh);
+            lod.levels_[level].push_back(mesh);
+        }
+    }
+    fclose(fid);
+    if (!success) {
+        lod.Clear();
+    }
+    return success;
+}
+
+bool WriteTriangleMeshLODToBIN(const std::string &filename,
+                               const geometry::TriangleMeshLOD &lod) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    LODHeader header;
+    header.num_levels = uint32_t(lod.NumLevels());
+    header.num_tiles = uint32_t(lod.NumTiles());
+    header.tile_depth = lod.tile_depth_;
+    Eigen::Vector3d::Map(header.origin) = lod.origin_;
+    header.tile_size = lod.tile_size_;
+    std::vector<int32_t> tile_indices;
+    for (const Eigen::Vector3i &index : lod.tile_indices_) {
+        tile_indices.insert(tile_indices.end(), index.data(),
+                            index.data() + 3);
+    }
+    // Offsets of the tile meshes from the start of the file, and the end of
+    // the file, so that a single tile mesh can be read
+    std::vector<uint64_t> offsets(
+            size_t(header.num_levels) * header.num_tiles + 1);
+    offsets[0] = kLODHeaderSize + tile_indices.size() * sizeof(int32_t) +
+                 offsets.size() * sizeof(uint64_t);
+    size_t i = 0;
+    for (const auto &level : lod.levels_) {
+        for (const auto &mesh : level) {
+            offsets[i + 1] = offsets[i] + GetTileMeshSize(*mesh);
+            i++;
+        }
+    }
+    bool success =
+            WriteArrayToBINFile(fid, kLODMagic, sizeof(kLODMagic)) &&
+            WriteArrayToBINFile(fid, &header.num_levels, 1) &&
+            WriteArrayToBINFile(fid, &header.num_tiles, 1) &&
+            WriteArrayToBINFile(fid, &header.tile_depth, 1) &&
+            WriteArrayToBINFile(fid, header.origin, 3) &&
+            WriteArrayToBINFile(fid, &header.tile_size, 1) &&
+            WriteArrayToBINFile(fid, tile_indices.data(),
+                                tile_indices.size()) &&
+            WriteArrayToBINFile(fid, offsets.data(), offsets.size());
+    for (const auto &level : lod.levels_) {
+        for (size_t t = 0; success && t < level.size(); t++) {
+            success = WriteTileMeshToBINFile(
+                    fid, GetTileCorner(header, lod.tile_indices_[t]),
+                    *level[t]);
+        }
+    }
+    fclose(fid);
+    return success;
+}
+
+bool ReadTriangleMeshLODTileFromBIN(const std::string &filename,
+                                    size_t level,
+                                    size_t tile,
+                                    geometry::TriangleMesh &mesh) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    LODHeader header;
+    bool success = ReadLODHeaderFromBINFile(fid, header);
+    if (success && (level >= header.num_levels || tile >= header.num_tiles)) {
+        utility::LogWarning(
+                "Read BIN failed: level {:d}, tile {:d} does not exist.",
+                level, tile);
+        success = false;
+    }
+    int32_t tile_index[3];
+    uint64_t offset;
+    size_t tile_index_offset = kLODHeaderSize + 3 * tile * sizeof(int32_t);
+    size_t offset_offset = kLODHeaderSize +
+                           3 * size_t(header.num_tiles) * sizeof(int32_t) +
+                           (level * header.num_tiles + tile) * sizeof(uint64_t);
+    success = success && fseek(fid, long(tile_index_offset), SEEK_SET) == 0 &&
+              ReadArrayFromBINFile(fid, tile_index, 3) &&
+              fseek(fid, long(offset_offset), SEEK_SET) == 0 &&
+              ReadArrayFromBINFile(fid, &offset, 1) &&
+              fseek(fid, long(offset), SEEK_SET) == 0 &&
+              ReadTileMeshFromBINFile(
+                      fid,
+                      GetTileCorner(header, Eigen::Vector3i(tile_index[0],
+                                                            tile_index[1],
+                                                            tile_index[2])),
+                      mesh);
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -29,8 +29,8 @@
 #include <Eigen/Dense>
 #include <iostream>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
@@ -51,10 +51,16 @@ public:
             const override {
         return type_;
     };
-    TransformationEstimationForColoredICP(double lambda_geometric = 0.968)
-        : lambda_geometric_(lambda_geometric) {
+    TransformationEstimationForColoredICP(
+            double lambda_geometric = 0.968,
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>(),
+            const IRLSOption &irls_option = IRLSOption())
+        : lambda_geometric_(lambda_geometric),
+          kernel_(std::move(kernel)),
+          irls_option_(irls_option) {
         if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0)
             lambda_geometric_ = 0.968;
+        if (!kernel_) kernel_ = std::make_shared<L2Loss>();
     }
     ~TransformationEstimationForColoredICP() override {}
 
@@ -69,6 +75,8 @@ public:
 
 public:
     double lambda_geometric_;
+    std::shared_ptr<RobustKernel> kernel_;
+    IRLSOption irls_option_;
 
 private:
     const TransformationEstimationType type_ =
@@ -77,11 +85,15 @@ private:
 
 std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
         const geometry::PointCloud &target,
-        const geometry::KDTreeSearchParamHybrid &search_param) {
+        const geometry::NeighborhoodGraph &neighborhood) {
     utility::LogDebug("InitializePointCloudForColoredICP");
 
-    geometry::KDTreeFlann tree;
-    tree.SetGeometry(target);
+    if (neighborhood.NumPoints() != target.points_.size()) {
+        utility::LogError(
+                "[RegistrationColoredICP] The neighborhood graph has {} "
+                "points, but the target point cloud has {}.",
+                neighborhood.NumPoints(), target.points_.size());
+    }
 
     auto output = std::make_shared<PointCloudForColoredICP>();
     output->colors_ = target.colors_;
@@ -91,20 +103,21 @@ std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
     size_t n_points = output->points_.size();
     output->color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
 
-    for (size_t k = 0; k < n_points; k++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < int(n_points); k++) {
         const Eigen::Vector3d &vt = output->points_[k];
         const Eigen::Vector3d &nt = output->normals_[k];
         double it = (output->colors_[k](0) + output->colors_[k](1) +
                      output->colors_[k](2)) /
                     3.0;
 
-        std::vector<int> point_idx;
-        std::vector<double> point_squared_distance;
+        const int *point_idx = neighborhood.NeighborIndices(k);
+        size_t nn = size_t(neighborhood.NumNeighbors(k));
 
-        if (tree.SearchHybrid(vt, search_param.radius_, search_param.max_nn_,
-                              point_idx, point_squared_distance) >= 4) {
+        if (nn >= 4) {
             // approximate image gradient of vt's tangential plane
-            size_t nn = point_idx.size();
             Eigen::MatrixXd A(nn, 3);
             Eigen::MatrixXd b(nn, 1);
             A.setZero();
@@ -154,61 +167,70 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
 
     const auto &target_c = (const PointCloudForColoredICP &)target;
 
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                size_t cs = corres[i][0];
-                size_t ct = corres[i][1];
-                const Eigen::Vector3d &vs = source.points_[cs];
-                const Eigen::Vector3d &vt = target.points_[ct];
-                const Eigen::Vector3d &nt = target.normals_[ct];
-
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
-
-                // project vs into vt's tangential plane
-                Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-                double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                             source.colors_[cs](2)) /
-                            3.0;
-                double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                             target.colors_[ct](2)) /
-                            3.0;
-                const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-                double is0_proj = (dit.dot(vs_proj - vt)) + it;
-
-                const Eigen::Matrix3d M =
-                        (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
-                         -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
-                         1.0 - nt(1) * nt(1), -nt(1) * nt(2), -nt(0) * nt(2),
-                         -nt(1) * nt(2), 1.0 - nt(2) * nt(2))
-                                .finished();
-
-                const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
-                        sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
-
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
-
-    bool is_success;
-    Eigen::Matrix4d extrinsic;
-    std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
-
-    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+    auto compute_system = [&](const Eigen::Matrix4d &transformation,
+                              double scale) {
+        const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+        const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+        auto compute_jacobian_and_residual =
+                [&](int i,
+                    std::vector<Eigen::Vector6d, utility::Vector6d_allocator>
+                            &J_r,
+                    std::vector<double> &r, std::vector<double> &w) {
+                    size_t cs = corres[i][0];
+                    size_t ct = corres[i][1];
+                    const Eigen::Vector3d vs = R * source.points_[cs] + t;
+                    const Eigen::Vector3d &vt = target.points_[ct];
+                    const Eigen::Vector3d &nt = target.normals_[ct];
+
+                    J_r.resize(2);
+                    r.resize(2);
+                    w.resize(2);
+
+                    J_r[0].block<3, 1>(0, 0) =
+                            sqrt_lambda_geometric * vs.cross(nt);
+                    J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
+                    r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
+                    w[0] = kernel_->Weight(r[0] / scale);
+
+                    // project vs into vt's tangential plane
+                    Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
+                    double is = (source.colors_[cs](0) +
+                                 source.colors_[cs](1) +
+                                 source.colors_[cs](2)) /
+                                3.0;
+                    double it = (target.colors_[ct](0) +
+                                 target.colors_[ct](1) +
+                                 target.colors_[ct](2)) /
+                                3.0;
+                    const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
+                    double is0_proj = (dit.dot(vs_proj - vt)) + it;
+
+                    const Eigen::Matrix3d M =
+                            (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
+                             -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
+                             1.0 - nt(1) * nt(1), -nt(1) * nt(2),
+                             -nt(0) * nt(2), -nt(1) * nt(2),
+                             1.0 - nt(2) * nt(2))
+                                    .finished();
+
+                    const Eigen::Vector3d &ditM = -dit.transpose() * M;
+                    J_r[1].block<3, 1>(0, 0) =
+                            sqrt_lambda_photometric * vs.cross(ditM);
+                    J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
+                    r[1] = sqrt_lambda_photometric * (is - is0_proj);
+                    w[1] = kernel_->Weight(r[1] / scale);
+                };
+
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        compute_jacobian_and_residual, (int)corres.size());
+        return std::make_tuple(JTJ, JTr);
+    };
+
+    return ComputeTransformationIRLS(compute_system, irls_option_);
 }
 
 double TransformationEstimationForColoredICP::ComputeRMSE(
@@ -254,12 +276,32 @@ RegistrationResult RegistrationColoredICP(
         double max_distance,
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
-        double lambda_geometric /* = 0.968*/) {
-    auto target_c = InitializePointCloudForColoredICP(
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel /* = nullptr*/,
+        const IRLSOption &irls_option /* = IRLSOption()*/) {
+    geometry::NeighborhoodGraph target_neighborhood(
             target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(
-            source, *target_c, max_distance, init,
-            TransformationEstimationForColoredICP(lambda_geometric), criteria);
+    return RegistrationColoredICP(source, target, target_neighborhood,
+                                  max_distance, init, criteria,
+                                  lambda_geometric, kernel, irls_option);
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::NeighborhoodGraph &target_neighborhood,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel /* = nullptr*/,
+        const IRLSOption &irls_option /* = IRLSOption()*/) {
+    auto target_c =
+            InitializePointCloudForColoredICP(target, target_neighborhood);
+    return RegistrationICP(source, *target_c, max_distance, init,
+                           TransformationEstimationForColoredICP(
+                                   lambda_geometric, kernel, irls_option),
+                           criteria);
 }
 
 }  // namespace registration
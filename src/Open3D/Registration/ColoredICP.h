@@ -27,14 +27,17 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 
 #include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/RobustKernel.h"
 
 namespace open3d {
 
 namespace geometry {
+class NeighborhoodGraph;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace registration {
 class RegistrationResult;
@@ -51,14 +54,46 @@ class RegistrationResult;
 /// \param init Initial transformation estimation.
 /// Default value: array([[1., 0., 0., 0.], [0., 1., 0., 0.], [0., 0., 1., 0.],
 /// [0., 0., 0., 1.]]). \param criteria  Convergence criteria. \param
-/// lambda_geometric  lambda_geometric value.
+/// lambda_geometric  lambda_geometric value. \param kernel Robust kernel
+/// applied to the geometric and photometric residuals, nullptr for least
+/// squares. \param irls_option Options of the IRLS solver.
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_distance,
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
-        double lambda_geometric = 0.968);
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = nullptr,
+        const IRLSOption &irls_option = IRLSOption());
+
+/// \brief Function for Colored ICP registration with precomputed target
+/// neighborhoods.
+///
+/// The neighborhoods are used to estimate the color gradients of the target.
+/// The other overload uses a hybrid search with radius 2 * max_distance and
+/// at most 30 neighbors.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_neighborhood Neighborhoods of all points of \p target.
+/// \param max_distance Maximum correspondence points-pair distance.
+/// \param init Initial transformation estimation.
+/// \param criteria Convergence criteria.
+/// \param lambda_geometric lambda_geometric value.
+/// \param kernel Robust kernel applied to the geometric and photometric
+/// residuals, nullptr for least squares.
+/// \param irls_option Options of the IRLS solver.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::NeighborhoodGraph &target_neighborhood,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = nullptr,
+        const IRLSOption &irls_option = IRLSOption());
 
 }  // namespace registration
 }  // namespace open3d
@@ -24,9 +24,21 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
 #include "Open3D/Registration/FastGlobalRegistration.h"
 
-#include "Open3D/Geometry/KDTreeFlann.h"
+#include <algorithm>
+#include <flann/flann.hpp>
+#include <memory>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Registration/Registration.h"
@@ -38,6 +50,45 @@ namespace open3d {
 namespace {
 using namespace registration;
 
+/// Nearest neighbour of every query feature among the indexed features.
+/// All queries go to flann in one batch, which splits them across threads and
+/// writes into the preallocated \p nn. The feature matrices are used in place,
+/// so \p reference must outlive the call.
+void SearchFeatureNearestNeighbors(const Eigen::MatrixXd& reference,
+                                   const Eigen::MatrixXd& query,
+                                   const FastGlobalRegistrationOption& option,
+                                   std::vector<int>& nn) {
+    const size_t dim = reference.rows();
+    nn.resize(query.cols());
+    if (reference.cols() == 0 || query.cols() == 0) {
+        std::fill(nn.begin(), nn.end(), -1);
+        return;
+    }
+    flann::Matrix<double> dataset((double*)reference.data(), reference.cols(),
+                                  dim);
+    std::unique_ptr<flann::Index<flann::L2<double>>> index;
+    flann::SearchParams param(-1, 0.0);
+    if (option.use_approximate_matching_) {
+        index.reset(new flann::Index<flann::L2<double>>(
+                dataset, flann::KDTreeIndexParams(std::max(
+                                 option.approximate_matching_trees_, 1))));
+        param.checks = option.approximate_matching_checks_;
+    } else {
+        index.reset(new flann::Index<flann::L2<double>>(
+                dataset, flann::KDTreeSingleIndexParams(15)));
+    }
+    index->buildIndex();
+#ifdef _OPENMP
+    param.cores = omp_get_max_threads();
+#endif
+    std::vector<double> dists(query.cols());
+    flann::Matrix<double> query_flann((double*)query.data(), query.cols(),
+                                      dim);
+    flann::Matrix<int> indices_flann(nn.data(), query.cols(), 1);
+    flann::Matrix<double> dists_flann(dists.data(), query.cols(), 1);
+    index->knnSearch(query_flann, indices_flann, dists_flann, 1, param);
+}
+
 std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
         const std::vector<Feature>& features_vec,
@@ -55,125 +106,120 @@ std::vector<std::pair<int, int>> AdvancedMatching(
     }
 
     // STEP 1) Initial matching
+    // Every feature of fj is matched into fi. Every feature of fi that got hit
+    // is matched back into fj.
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
-    std::vector<int> i_to_j(nPti, -1);
+    const Eigen::MatrixXd& feature_i = features_vec[fi].data_;
+    const Eigen::MatrixXd& feature_j = features_vec[fj].data_;
+    std::vector<int> j_to_i;
+    SearchFeatureNearestNeighbors(feature_i, feature_j, option, j_to_i);
+
+    std::vector<char> is_hit(nPti, 0);
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
-        }
-        corres_ji.push_back(std::pair<int, int>(i, j));
+        if (j_to_i[j] >= 0) is_hit[j_to_i[j]] = 1;
     }
+    std::vector<int> hit_i;
+    hit_i.reserve(nPti);
     for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
+        if (is_hit[i]) hit_i.push_back(i);
+    }
+    Eigen::MatrixXd feature_hit_i(feature_i.rows(), hit_i.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < (int)hit_i.size(); k++) {
+        feature_hit_i.col(k) = feature_i.col(hit_i[k]);
+    }
+    std::vector<int> hit_i_to_j;
+    SearchFeatureNearestNeighbors(feature_j, feature_hit_i, option,
+                                  hit_i_to_j);
+    std::vector<int> i_to_j(nPti, -1);
+    for (size_t k = 0; k < hit_i.size(); k++) {
+        i_to_j[hit_i[k]] = hit_i_to_j[k];
     }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
+    utility::LogDebug("points are remained : {:d}",
+                      (int)(hit_i.size() + nPtj));
 
     // STEP 2) CROSS CHECK
+    // Keep the mutual nearest neighbours. Each feature has a single nearest
+    // neighbour, so a pair survives iff it is found in both directions.
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
-    for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
+    for (int i : hit_i) {
+        int j = i_to_j[i];
+        if (j >= 0 && j_to_i[j] == i) {
+            corres_cross.push_back(std::pair<int, int>(i, j));
         }
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
+    // Trials are evaluated in parallel batches. Accepted tuples are collected
+    // in trial order, so the result is the same as testing one by one until
+    // maximum_tuple_count_ is reached.
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
+    const std::vector<Eigen::Vector3d>& points_i = point_cloud_vec[fi].points_;
+    const std::vector<Eigen::Vector3d>& points_j = point_cloud_vec[fj].points_;
 
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
+    const int batch_size = 4096;
+    std::vector<Eigen::Vector3i> batch_tuple(batch_size);
+    std::vector<char> batch_accepted(batch_size);
+    int trial = 0;
+    while (trial < number_of_trial && cnt < option.maximum_tuple_count_) {
+        int batch_num = std::min(batch_size, number_of_trial - trial);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int b = 0; b < batch_num; b++) {
+            Eigen::Vector3i tuple(utility::UniformRandInt(0, ncorr - 1),
+                                  utility::UniformRandInt(0, ncorr - 1),
+                                  utility::UniformRandInt(0, ncorr - 1));
+            batch_tuple[b] = tuple;
+            int idi0 = corres_cross[tuple(0)].first;
+            int idj0 = corres_cross[tuple(0)].second;
+            int idi1 = corres_cross[tuple(1)].first;
+            int idj1 = corres_cross[tuple(1)].second;
+            int idi2 = corres_cross[tuple(2)].first;
+            int idj2 = corres_cross[tuple(2)].second;
+
+            // collect 3 points from i-th fragment
+            double li0 = (points_i[idi0] - points_i[idi1]).norm();
+            double li1 = (points_i[idi1] - points_i[idi2]).norm();
+            double li2 = (points_i[idi2] - points_i[idi0]).norm();
+
+            // collect 3 points from j-th fragment
+            double lj0 = (points_j[idj0] - points_j[idj1]).norm();
+            double lj1 = (points_j[idj1] - points_j[idj2]).norm();
+            double lj2 = (points_j[idj2] - points_j[idj0]).norm();
+
+            // check tuple constraint
+            batch_accepted[b] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                                (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                                (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int b = 0; b < batch_num; b++) {
+            trial++;
+            if (!batch_accepted[b]) continue;
+            for (int k = 0; k < 3; k++) {
+                corres_tuple.push_back(corres_cross[batch_tuple[b](k)]);
+            }
             cnt++;
+            if (cnt >= option.maximum_tuple_count_) break;
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
-                      number_of_trial, i);
+                      number_of_trial, trial);
 
     if (swapped) {
-        std::vector<std::pair<int, int>> temp;
-        for (size_t i = 0; i < corres_tuple.size(); i++)
-            temp.push_back(std::pair<int, int>(corres_tuple[i].second,
-                                               corres_tuple[i].first));
-        corres_tuple.clear();
-        corres_tuple = temp;
+        for (auto& c : corres_tuple) {
+            std::swap(c.first, c.second);
+        }
     }
     utility::LogDebug("\t[final] matches {:d}.", (int)corres_tuple.size());
     return corres_tuple;
@@ -371,3 +417,7 @@ RegistrationResult FastGlobalRegistration(
 
 }  // namespace registration
 }  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -60,20 +60,31 @@ public:
     /// \param iteration_number Maximum number of iterations.
     /// \param tuple_scale Similarity measure used for tuples of feature points.
     /// \param maximum_tuple_count Maximum numer of tuples.
+    /// \param use_approximate_matching Set to `true` to match features with a
+    /// randomized k-d forest instead of an exact k-d tree.
+    /// \param approximate_matching_trees Number of randomized k-d trees.
+    /// \param approximate_matching_checks Number of leaves visited per query,
+    /// higher is more accurate and slower.
     FastGlobalRegistrationOption(double division_factor = 1.4,
                                  bool use_absolute_scale = false,
                                  bool decrease_mu = true,
                                  double maximum_correspondence_distance = 0.025,
                                  int iteration_number = 64,
                                  double tuple_scale = 0.95,
-                                 int maximum_tuple_count = 1000)
+                                 int maximum_tuple_count = 1000,
+                                 bool use_approximate_matching = false,
+                                 int approximate_matching_trees = 4,
+                                 int approximate_matching_checks = 128)
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
           maximum_correspondence_distance_(maximum_correspondence_distance),
           iteration_number_(iteration_number),
           tuple_scale_(tuple_scale),
-          maximum_tuple_count_(maximum_tuple_count) {}
+          maximum_tuple_count_(maximum_tuple_count),
+          use_approximate_matching_(use_approximate_matching),
+          approximate_matching_trees_(approximate_matching_trees),
+          approximate_matching_checks_(approximate_matching_checks) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -94,6 +105,13 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// Set to `true` to match features with a randomized k-d forest instead of
+    /// an exact k-d tree.
+    bool use_approximate_matching_;
+    /// Number of randomized k-d trees used for approximate matching.
+    int approximate_matching_trees_;
+    /// Number of leaves visited per query in approximate matching.
+    int approximate_matching_checks_;
 };
 
 RegistrationResult FastGlobalRegistration(
@@ -28,7 +28,7 @@
 
 #include <Eigen/Dense>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 
@@ -73,8 +73,7 @@ Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
 
 std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const geometry::NeighborhoodGraph &neighborhood) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
 #ifdef _OPENMP
@@ -83,12 +82,12 @@ std::shared_ptr<Feature> ComputeSPFHFeature(
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        int num_neighbors = neighborhood.NumNeighbors(i);
+        const int *indices = neighborhood.NeighborIndices(i);
+        if (num_neighbors > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            double hist_incr = 100.0 / (double)(num_neighbors - 1);
+            for (int k = 1; k < num_neighbors; k++) {
                 // skip the point itself, compute histogram
                 auto pf = ComputePairFeatures(point, normal,
                                               input.points_[indices[k]],
@@ -118,6 +117,18 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    if (input.HasNormals() == false) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    geometry::NeighborhoodGraph neighborhood(input, search_param);
+    return ComputeFPFHFeature(input, neighborhood);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborhoodGraph &neighborhood) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (input.HasNormals() == false) {
@@ -125,18 +136,23 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    if (neighborhood.NumPoints() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] The neighborhood graph has {} points, "
+                "but the point cloud has {}.",
+                neighborhood.NumPoints(), input.points_.size());
+    }
+    auto spfh = ComputeSPFHFeature(input, neighborhood);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        int num_neighbors = neighborhood.NumNeighbors(i);
+        const int *indices = neighborhood.NeighborIndices(i);
+        const double *distance2 = neighborhood.NeighborDistance2(i);
+        if (num_neighbors > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+            for (int k = 1; k < num_neighbors; k++) {
                 // skip the point itself
                 double dist = distance2[k];
                 if (dist == 0.0) continue;
@@ -35,8 +35,9 @@
 namespace open3d {
 
 namespace geometry {
+class NeighborhoodGraph;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace registration {
 
@@ -72,5 +73,15 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud from precomputed
+/// neighborhoods.
+///
+/// \param input The Input point cloud.
+/// \param neighborhood Neighborhoods of all points of \p input, e.g. shared
+/// with PointCloud::EstimateNormals.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborhoodGraph &neighborhood);
+
 }  // namespace registration
 }  // namespace open3d
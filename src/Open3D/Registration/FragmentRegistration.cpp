@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/FragmentRegistration.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+using namespace registration;
+
+/// Per-fragment preprocessing shared by all the pairs a fragment is part of.
+struct FragmentCache {
+    std::shared_ptr<geometry::PointCloud> pcd_down_;
+    std::shared_ptr<Feature> fpfh_;
+    std::unique_ptr<geometry::KDTreeFlann> kdtree_;
+};
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RegisterOdometryPair(
+        const FragmentCache &source,
+        const FragmentCache &target,
+        const Eigen::Matrix4d &init,
+        const FragmentRegistrationOption &option) {
+    const double distance_threshold = option.voxel_size_ * 1.4;
+    auto result = RegistrationICP(*source.pcd_down_, *target.pcd_down_,
+                                  *target.kdtree_, distance_threshold, init,
+                                  TransformationEstimationPointToPlane(),
+                                  option.icp_criteria_);
+    Eigen::Matrix6d information = GetInformationMatrixFromPointClouds(
+            *source.pcd_down_, *target.pcd_down_, *target.kdtree_,
+            distance_threshold, result.transformation_);
+    return std::make_tuple(true, Eigen::Matrix4d(result.transformation_),
+                           information);
+}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RegisterLoopClosurePair(
+        const FragmentCache &source,
+        const FragmentCache &target,
+        const FragmentRegistrationOption &option) {
+    const double distance_threshold = option.voxel_size_ * 1.4;
+    RegistrationResult result;
+    if (option.use_fast_global_registration_) {
+        FastGlobalRegistrationOption fgr_option;
+        fgr_option.maximum_correspondence_distance_ = distance_threshold;
+        result = FastGlobalRegistration(*source.pcd_down_, *target.pcd_down_,
+                                        *source.fpfh_, *target.fpfh_,
+                                        fgr_option);
+    } else {
+        CorrespondenceCheckerBasedOnEdgeLength edge_length_checker(0.9);
+        CorrespondenceCheckerBasedOnDistance distance_checker(
+                distance_threshold);
+        result = RegistrationRANSACBasedOnFeatureMatching(
+                *source.pcd_down_, *target.pcd_down_, *source.fpfh_,
+                *target.fpfh_, distance_threshold,
+                TransformationEstimationPointToPoint(false), 4,
+                {edge_length_checker, distance_checker},
+                option.ransac_criteria_);
+    }
+    if (result.transformation_.trace() == 4.0) {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    Eigen::Matrix6d information = GetInformationMatrixFromPointClouds(
+            *source.pcd_down_, *target.pcd_down_, *target.kdtree_,
+            distance_threshold, result.transformation_);
+    size_t min_size = std::min(source.pcd_down_->points_.size(),
+                               target.pcd_down_->points_.size());
+    if (information(5, 5) / (double)min_size <
+        option.minimum_information_ratio_) {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    return std::make_tuple(true, Eigen::Matrix4d(result.transformation_),
+                           information);
+}
+
+}  // unnamed namespace
+
+namespace registration {
+
+std::shared_ptr<PoseGraph> RegisterFragments(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<FragmentPair> &pairs,
+        const FragmentRegistrationOption &option
+        /* = FragmentRegistrationOption()*/) {
+    auto pose_graph = std::make_shared<PoseGraph>();
+    int n_fragments = (int)fragments.size();
+    if (option.voxel_size_ <= 0.0) {
+        utility::LogError("[RegisterFragments] voxel_size must be positive.");
+    }
+
+    // Find out which preprocessing each fragment needs.
+    std::vector<char> need_pcd(n_fragments, 0);
+    std::vector<char> need_fpfh(n_fragments, 0);
+    std::vector<char> need_kdtree(n_fragments, 0);
+    for (const auto &pair : pairs) {
+        if (pair.source_id_ < 0 || pair.source_id_ >= n_fragments ||
+            pair.target_id_ < 0 || pair.target_id_ >= n_fragments ||
+            pair.source_id_ == pair.target_id_) {
+            utility::LogError(
+                    "[RegisterFragments] Invalid fragment pair ({:d}, {:d}).",
+                    pair.source_id_, pair.target_id_);
+        }
+        if (!fragments[pair.source_id_] || !fragments[pair.target_id_]) {
+            utility::LogError(
+                    "[RegisterFragments] Fragment pair ({:d}, {:d}) refers to "
+                    "an empty fragment.",
+                    pair.source_id_, pair.target_id_);
+        }
+        need_pcd[pair.source_id_] = need_pcd[pair.target_id_] = 1;
+        need_kdtree[pair.target_id_] = 1;
+        if (!pair.has_initial_transformation_) {
+            need_fpfh[pair.source_id_] = need_fpfh[pair.target_id_] = 1;
+        }
+    }
+
+    // Preprocess every fragment once.
+    std::vector<FragmentCache> caches(n_fragments);
+    const geometry::KDTreeSearchParamHybrid normal_param(
+            option.voxel_size_ * 2.0, 30);
+    const geometry::KDTreeSearchParamHybrid fpfh_param(option.voxel_size_ * 5.0,
+                                                       100);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int f = 0; f < n_fragments; f++) {
+        if (!need_pcd[f]) continue;
+        auto &cache = caches[f];
+        cache.pcd_down_ = fragments[f]->VoxelDownSample(option.voxel_size_);
+        cache.pcd_down_->EstimateNormals(normal_param);
+        if (need_fpfh[f]) {
+            cache.fpfh_ = ComputeFPFHFeature(*cache.pcd_down_, fpfh_param);
+        }
+        if (need_kdtree[f]) {
+            cache.kdtree_.reset(new geometry::KDTreeFlann(*cache.pcd_down_));
+        }
+    }
+    utility::LogDebug("[RegisterFragments] Preprocessed {:d} fragments.",
+                      (int)std::count(need_pcd.begin(), need_pcd.end(), 1));
+
+    // Schedule loop closure pairs (global registration) before odometry pairs
+    // and larger pairs before smaller ones, so that the dynamic schedule does
+    // not end on a long tail.
+    auto pair_cost = [&](const FragmentPair &pair) {
+        return caches[pair.source_id_].pcd_down_->points_.size() +
+               caches[pair.target_id_].pcd_down_->points_.size();
+    };
+    std::vector<int> order(pairs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        if (pairs[a].has_initial_transformation_ !=
+            pairs[b].has_initial_transformation_) {
+            return !pairs[a].has_initial_transformation_;
+        }
+        return pair_cost(pairs[a]) > pair_cost(pairs[b]);
+    });
+
+    std::vector<char> success(pairs.size(), 0);
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            pairs.size());
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations(
+            pairs.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int k = 0; k < (int)order.size(); k++) {
+        int p = order[k];
+        const auto &pair = pairs[p];
+        bool is_success;
+        Eigen::Matrix4d transformation;
+        Eigen::Matrix6d information;
+        if (pair.has_initial_transformation_) {
+            std::tie(is_success, transformation, information) =
+                    RegisterOdometryPair(caches[pair.source_id_],
+                                         caches[pair.target_id_],
+                                         pair.initial_transformation_, option);
+        } else {
+            std::tie(is_success, transformation, information) =
+                    RegisterLoopClosurePair(caches[pair.source_id_],
+                                            caches[pair.target_id_], option);
+        }
+        success[p] = is_success;
+        transformations[p] = transformation;
+        informations[p] = information;
+        utility::LogDebug("[RegisterFragments] Pair ({:d}, {:d}) {}.",
+                          pair.source_id_, pair.target_id_,
+                          is_success ? "registered" : "rejected");
+    }
+
+    // Chain the odometry pairs into initial node poses.
+    std::vector<int> odometry_pair(n_fragments, -1);
+    for (size_t p = 0; p < pairs.size(); p++) {
+        if (success[p] && pairs[p].has_initial_transformation_ &&
+            pairs[p].target_id_ == pairs[p].source_id_ + 1 &&
+            odometry_pair[pairs[p].source_id_] == -1) {
+            odometry_pair[pairs[p].source_id_] = (int)p;
+        }
+    }
+    Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+    for (int f = 0; f < n_fragments; f++) {
+        if (f > 0 && odometry_pair[f - 1] != -1) {
+            odometry = transformations[odometry_pair[f - 1]] * odometry;
+        }
+        pose_graph->nodes_.push_back(PoseGraphNode(odometry.inverse()));
+    }
+    for (size_t p = 0; p < pairs.size(); p++) {
+        if (!success[p]) continue;
+        pose_graph->edges_.push_back(PoseGraphEdge(
+                pairs[p].source_id_, pairs[p].target_id_, transformations[p],
+                informations[p], !pairs[p].has_initial_transformation_));
+    }
+    return pose_graph;
+}
+
+}  // namespace registration
+}  // namespace open3d
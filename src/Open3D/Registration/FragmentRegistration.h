@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+class PoseGraph;
+
+/// \class FragmentPair
+///
+/// \brief A candidate pair of fragments to be registered.
+///
+/// A pair with an initial transformation (e.g. from odometry) is refined with
+/// point to plane ICP and yields a certain edge. A pair without one is
+/// registered globally from FPFH features and yields an uncertain (loop
+/// closure) edge.
+class FragmentPair {
+public:
+    /// \brief Parameterized Constructor for a loop closure pair.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    FragmentPair(int source_id = -1, int target_id = -1)
+        : source_id_(source_id),
+          target_id_(target_id),
+          has_initial_transformation_(false),
+          initial_transformation_(Eigen::Matrix4d::Identity()) {}
+    /// \brief Parameterized Constructor for an odometry pair.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    /// \param initial_transformation Initial transformation from source to
+    /// target.
+    FragmentPair(int source_id,
+                 int target_id,
+                 const Eigen::Matrix4d &initial_transformation)
+        : source_id_(source_id),
+          target_id_(target_id),
+          has_initial_transformation_(true),
+          initial_transformation_(initial_transformation) {}
+    ~FragmentPair() {}
+
+public:
+    /// Index of the source fragment.
+    int source_id_;
+    /// Index of the target fragment.
+    int target_id_;
+    /// Whether \p initial_transformation_ is valid.
+    bool has_initial_transformation_;
+    /// Initial transformation from source to target.
+    Eigen::Matrix4d_u initial_transformation_;
+};
+
+/// \class FragmentRegistrationOption
+///
+/// \brief Options for RegisterFragments().
+///
+/// The defaults follow the reconstruction system: normals are estimated with
+/// radius 2 * voxel_size, FPFH with radius 5 * voxel_size and the
+/// correspondence distance is 1.4 * voxel_size.
+class FragmentRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Voxel size used to downsample the fragments.
+    /// \param use_fast_global_registration Use FastGlobalRegistration for loop
+    /// closure pairs, RANSAC otherwise.
+    /// \param minimum_information_ratio Loop closure pairs whose
+    /// information(5, 5) divided by the smaller point count is below this
+    /// ratio are rejected.
+    FragmentRegistrationOption(double voxel_size = 0.05,
+                               bool use_fast_global_registration = true,
+                               double minimum_information_ratio = 0.3)
+        : voxel_size_(voxel_size),
+          use_fast_global_registration_(use_fast_global_registration),
+          minimum_information_ratio_(minimum_information_ratio),
+          ransac_criteria_(4000000, 500),
+          icp_criteria_(1e-6, 1e-6, 50) {}
+    ~FragmentRegistrationOption() {}
+
+public:
+    /// Voxel size used to downsample the fragments.
+    double voxel_size_;
+    /// Use FastGlobalRegistration for loop closure pairs, RANSAC otherwise.
+    bool use_fast_global_registration_;
+    /// Threshold on information(5, 5) / min(#source points, #target points)
+    /// below which a loop closure pair is rejected.
+    double minimum_information_ratio_;
+    /// Convergence criteria of RANSAC.
+    RANSACConvergenceCriteria ransac_criteria_;
+    /// Convergence criteria of ICP for odometry pairs.
+    ICPConvergenceCriteria icp_criteria_;
+};
+
+/// \brief Function to register many fragment pairs and build a pose graph.
+///
+/// Every fragment that appears in \p pairs is downsampled, gets normals, FPFH
+/// features (if it takes part in a loop closure pair) and a KDTree exactly
+/// once. The pairs are then registered in parallel, the most expensive pairs
+/// first, with dynamic scheduling across the threads.
+///
+/// The returned pose graph has one node per fragment, initialized by chaining
+/// the successful odometry pairs (i, i + 1), and one edge per successful pair
+/// in the order of \p pairs.
+///
+/// \param fragments The fragment point clouds.
+/// \param pairs Candidate pairs of fragment indices.
+/// \param option Options for preprocessing and registration.
+std::shared_ptr<PoseGraph> RegisterFragments(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<FragmentPair> &pairs,
+        const FragmentRegistrationOption &option =
+                FragmentRegistrationOption());
+
+}  // namespace registration
+}  // namespace open3d
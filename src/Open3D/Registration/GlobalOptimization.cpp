@@ -460,6 +460,172 @@ bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     return true;
 }
 
+/// Function to compute the residual of Eq (9) in [Choi et al 2015] restricted
+/// to the given edges.
+double ComputeResidualOfEdges(const PoseGraph &pose_graph,
+                              const std::vector<int> &edges,
+                              const double line_process_weight) {
+    double residual = 0.0;
+    for (int iter_edge : edges) {
+        const PoseGraphEdge &te = pose_graph.edges_[iter_edge];
+        Eigen::Matrix4d X_inv, Ts, Tt_inv;
+        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
+        residual += te.confidence_ * e.transpose() * te.information_ * e +
+                    line_process_weight * pow(sqrt(te.confidence_) - 1, 2.0);
+    }
+    return residual;
+}
+
+/// Function to update the line process of the given uncertain edges and to
+/// compute the linear system of the active nodes. Nodes that are not active
+/// are held fixed, so their Jacobian blocks are dropped.
+void ComputeLinearSystemOfActiveNodes(
+        PoseGraph &pose_graph,
+        const std::vector<int> &edges,
+        const std::vector<int> &active_index,
+        int n_active,
+        const double line_process_weight,
+        Eigen::SparseMatrix<double> &H,
+        Eigen::VectorXd &b) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(edges.size() * 4 * 36);
+    b.setZero(n_active * 6);
+    for (int iter_edge : edges) {
+        PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        Eigen::Matrix4d X_inv, Ts, Tt_inv;
+        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
+        if (t.uncertain_) {
+            double residual_square = e.transpose() * t.information_ * e;
+            double temp = line_process_weight /
+                          (line_process_weight + residual_square);
+            t.confidence_ = temp * temp;
+        }
+
+        Eigen::Matrix6d Js, Jt;
+        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+        const Eigen::Matrix6d *J[2] = {&Js, &Jt};
+        int id[2] = {active_index[t.source_node_id_],
+                     active_index[t.target_node_id_]};
+        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+        for (int u = 0; u < 2; u++) {
+            if (id[u] < 0) continue;
+            Eigen::Matrix6d JuT_Info = J[u]->transpose() * t.information_;
+            for (int v = 0; v < 2; v++) {
+                if (id[v] < 0) continue;
+                Eigen::Matrix6d block = t.confidence_ * JuT_Info * (*J[v]);
+                for (int r = 0; r < 6; r++) {
+                    for (int c = 0; c < 6; c++) {
+                        triplets.push_back(Eigen::Triplet<double>(
+                                id[u] * 6 + r, id[v] * 6 + c, block(r, c)));
+                    }
+                }
+            }
+            b.block<6, 1>(id[u] * 6, 0).noalias() -=
+                    t.confidence_ * eT_Info.transpose() * (*J[u]);
+        }
+    }
+    H.resize(n_active * 6, n_active * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+/// Function to optimize the active nodes of a pose graph with the
+/// Levenberg-Marquardt algorithm, the other nodes being held fixed. The sparse
+/// pattern of the system does not change between iterations, so its symbolic
+/// analysis is done once.
+void OptimizeActiveNodes(
+        PoseGraph &pose_graph,
+        const std::vector<int> &active_nodes,
+        const std::vector<int> &active_index,
+        const std::vector<int> &edges,
+        const double line_process_weight,
+        const GlobalOptimizationConvergenceCriteria &criteria) {
+    int n_active = (int)active_nodes.size();
+    Eigen::SparseMatrix<double> H, H_LM;
+    Eigen::VectorXd b;
+    ComputeLinearSystemOfActiveNodes(pose_graph, edges, active_index, n_active,
+                                     line_process_weight, H, b);
+    double current_residual =
+            ComputeResidualOfEdges(pose_graph, edges, line_process_weight);
+    if (CheckRightTerm(b, criteria)) return;
+
+    Eigen::SparseMatrix<double> H_I(n_active * 6, n_active * 6);
+    H_I.setIdentity();
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.analyzePattern(H + H_I);
+
+    double current_lambda = 1e-5 * Eigen::VectorXd(H.diagonal()).maxCoeff();
+    double ni = 2.0;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses(n_active);
+    Eigen::VectorXd x(n_active * 6);
+    bool stop = false;
+    for (int iter = 0; !stop; iter++) {
+        for (int i = 0; i < n_active; i++) {
+            poses[i] = pose_graph.nodes_[active_nodes[i]].pose_;
+            x.block<6, 1>(i * 6, 0) =
+                    utility::TransformMatrix4dToVector6d(poses[i]);
+        }
+        double rho = 0.0;
+        int lm_count = 0;
+        do {
+            H_LM = H + current_lambda * H_I;
+            solver.factorize(H_LM);
+            if (solver.info() != Eigen::Success) {
+                utility::LogWarning(
+                        "[IncrementalGlobalOptimization] Failed to factorize "
+                        "the linear system.");
+                return;
+            }
+            Eigen::VectorXd delta = solver.solve(b);
+            stop = stop || CheckRelativeIncrement(delta, x, criteria);
+            if (stop) break;
+            for (int i = 0; i < n_active; i++) {
+                pose_graph.nodes_[active_nodes[i]].pose_ =
+                        utility::TransformVector6dToMatrix4d(
+                                delta.block<6, 1>(i * 6, 0)) *
+                        poses[i];
+            }
+            double new_residual = ComputeResidualOfEdges(pose_graph, edges,
+                                                         line_process_weight);
+            rho = (current_residual - new_residual) /
+                  (delta.dot(current_lambda * delta + b) + 1e-3);
+            if (rho > 0) {
+                stop = stop || CheckRelativeResidualIncrement(
+                                       current_residual, new_residual,
+                                       criteria);
+                double alpha = 1. - pow((2 * rho - 1), 3);
+                alpha = (std::min)(alpha, criteria.upper_scale_factor_);
+                double scaleFactor =
+                        (std::max)(criteria.lower_scale_factor_, alpha);
+                current_lambda *= scaleFactor;
+                ni = 2;
+                current_residual = new_residual;
+            } else {
+                for (int i = 0; i < n_active; i++) {
+                    pose_graph.nodes_[active_nodes[i]].pose_ = poses[i];
+                }
+                current_lambda *= ni;
+                ni *= 2;
+            }
+            lm_count++;
+            stop = stop || CheckMaxIterationLM(lm_count, criteria);
+        } while (!((rho > 0) || stop));
+        if (stop) break;
+        ComputeLinearSystemOfActiveNodes(pose_graph, edges, active_index,
+                                         n_active, line_process_weight, H, b);
+        current_residual =
+                ComputeResidualOfEdges(pose_graph, edges, line_process_weight);
+        utility::LogDebug(
+                "[IncrementalGlobalOptimization] [Iteration {:02d}] residual "
+                ": {:e}",
+                iter, current_residual);
+        stop = CheckRightTerm(b, criteria) ||
+               CheckResidual(current_residual, criteria) ||
+               CheckMaxIteration(iter, criteria);
+    }
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -717,5 +883,101 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+int IncrementalGlobalOptimization::AddNode(const PoseGraphNode &node) {
+    pose_graph_.nodes_.push_back(node);
+    node_edges_.push_back(std::vector<int>());
+    return (int)pose_graph_.nodes_.size() - 1;
+}
+
+void IncrementalGlobalOptimization::AddEdge(const PoseGraphEdge &edge) {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+        edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes ||
+        edge.source_node_id_ == edge.target_node_id_) {
+        utility::LogError(
+                "[IncrementalGlobalOptimization] Invalid edge ({:d}, {:d}).",
+                edge.source_node_id_, edge.target_node_id_);
+    }
+    int edge_id = (int)pose_graph_.edges_.size();
+    pose_graph_.edges_.push_back(edge);
+    node_edges_[edge.source_node_id_].push_back(edge_id);
+    node_edges_[edge.target_node_id_].push_back(edge_id);
+    information_sum_ += edge.information_(5, 5);
+    first_affected_node_ = (std::min)(
+            first_affected_node_,
+            (std::min)(edge.source_node_id_, edge.target_node_id_));
+}
+
+void IncrementalGlobalOptimization::Update() {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    num_affected_nodes_ = 0;
+    if (first_affected_node_ >= n_nodes) return;
+    num_updates_++;
+    if (full_optimization_interval_ > 0 &&
+        num_updates_ % full_optimization_interval_ == 0) {
+        OptimizeFull();
+        return;
+    }
+
+    int reference_node = option_.reference_node_;
+    if (reference_node < 0 || reference_node >= n_nodes) reference_node = 0;
+    std::vector<int> active_nodes;
+    std::vector<int> active_index(n_nodes, -1);
+    for (int i = first_affected_node_; i < n_nodes; i++) {
+        if (i == reference_node) continue;
+        active_index[i] = (int)active_nodes.size();
+        active_nodes.push_back(i);
+    }
+    first_affected_node_ = n_nodes;
+    num_affected_nodes_ = (int)active_nodes.size();
+    if (active_nodes.empty()) return;
+
+    // Edges incident to the active nodes, each listed once.
+    std::vector<int> edges;
+    for (int i : active_nodes) {
+        for (int iter_edge : node_edges_[i]) {
+            const PoseGraphEdge &t = pose_graph_.edges_[iter_edge];
+            int other = t.source_node_id_ == i ? t.target_node_id_
+                                               : t.source_node_id_;
+            if (active_index[other] >= 0 && other < i) continue;
+            edges.push_back(iter_edge);
+        }
+    }
+
+    int n_edges = (int)pose_graph_.edges_.size();
+    double line_process_weight =
+            option_.preference_loop_closure_ *
+            pow(option_.max_correspondence_distance_, 2) *
+            (information_sum_ / (double)n_edges);
+    utility::LogDebug(
+            "[IncrementalGlobalOptimization] Optimizing {:d} of {:d} nodes "
+            "and {:d} of {:d} edges.",
+            num_affected_nodes_, n_nodes, (int)edges.size(), n_edges);
+    OptimizeActiveNodes(pose_graph_, active_nodes, active_index, edges,
+                        line_process_weight, criteria_);
+}
+
+void IncrementalGlobalOptimization::OptimizeFull() {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    first_affected_node_ = n_nodes;
+    num_affected_nodes_ = n_nodes;
+    if (n_nodes == 0) return;
+    GlobalOptimization(pose_graph_, GlobalOptimizationLevenbergMarquardt(),
+                       criteria_, option_);
+    RebuildNodeEdges();
+}
+
+void IncrementalGlobalOptimization::RebuildNodeEdges() {
+    node_edges_.assign(pose_graph_.nodes_.size(), std::vector<int>());
+    information_sum_ = 0.0;
+    for (int iter_edge = 0; iter_edge < (int)pose_graph_.edges_.size();
+         iter_edge++) {
+        const PoseGraphEdge &t = pose_graph_.edges_[iter_edge];
+        node_edges_[t.source_node_id_].push_back(iter_edge);
+        node_edges_[t.target_node_id_].push_back(iter_edge);
+        information_sum_ += t.information_(5, 5);
+    }
+}
+
 }  // namespace registration
 }  // namespace open3d
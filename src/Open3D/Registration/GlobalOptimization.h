@@ -27,15 +27,15 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
 
 namespace open3d {
 namespace registration {
 
-class PoseGraph;
-
 /// Function to optimize a PoseGraph
 /// Reference:
 /// [Kümmerle et al 2011]
@@ -61,5 +61,80 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class IncrementalGlobalOptimization
+///
+/// \brief Pose graph optimizer for graphs that grow over time.
+///
+/// Nodes and edges are appended with AddNode() and AddEdge(). Update() then
+/// re-optimizes only the affected part of the graph: with nodes added in
+/// chronological order, that is every node from the oldest node touched by a
+/// new edge up to the newest node, as in iSAM with a chronological variable
+/// ordering. Older nodes are held fixed and their edges to the affected nodes
+/// act as priors, so only edges incident to affected nodes are relinearized
+/// and a sparse system of the affected nodes is factorized. Every
+/// full_optimization_interval_ updates the whole graph is optimized with
+/// GlobalOptimization() instead, which also prunes invalid loop closures.
+class IncrementalGlobalOptimization {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param criteria Convergence criteria of each update.
+    /// \param option Global optimization options. The reference node (node 0
+    /// if reference_node_ is invalid) is never moved by incremental updates.
+    /// \param full_optimization_interval Number of calls to Update() between
+    /// two full optimizations. Set to 0 to never run one.
+    IncrementalGlobalOptimization(
+            const GlobalOptimizationConvergenceCriteria &criteria =
+                    GlobalOptimizationConvergenceCriteria(),
+            const GlobalOptimizationOption &option =
+                    GlobalOptimizationOption(),
+            int full_optimization_interval = 0)
+        : criteria_(criteria),
+          option_(option),
+          full_optimization_interval_(full_optimization_interval),
+          first_affected_node_(0),
+          num_updates_(0),
+          num_affected_nodes_(0),
+          information_sum_(0.0) {}
+    ~IncrementalGlobalOptimization() {}
+
+public:
+    /// Appends a node and returns its index.
+    int AddNode(const PoseGraphNode &node);
+    /// Appends an edge between two existing nodes.
+    void AddEdge(const PoseGraphEdge &edge);
+    /// Optimizes the part of the graph affected by the nodes and edges added
+    /// since the last update, or the full graph if it is due.
+    void Update();
+    /// Optimizes the full graph with GlobalOptimization().
+    void OptimizeFull();
+    /// Returns the current pose graph.
+    const PoseGraph &GetPoseGraph() const { return pose_graph_; }
+    /// Returns the number of nodes optimized by the last update.
+    int GetNumberOfAffectedNodes() const { return num_affected_nodes_; }
+
+public:
+    /// Convergence criteria of each update.
+    GlobalOptimizationConvergenceCriteria criteria_;
+    /// Global optimization options.
+    GlobalOptimizationOption option_;
+    /// Number of calls to Update() between two full optimizations, 0 for
+    /// never.
+    int full_optimization_interval_;
+
+private:
+    void RebuildNodeEdges();
+
+private:
+    PoseGraph pose_graph_;
+    /// Edges incident to each node.
+    std::vector<std::vector<int>> node_edges_;
+    int first_affected_node_;
+    int num_updates_;
+    int num_affected_nodes_;
+    /// Sum of information_(5, 5) over the edges, for the line process weight.
+    double information_sum_;
+};
+
 }  // namespace registration
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <algorithm>
 #include <cstdlib>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
@@ -126,6 +127,46 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+/// Number of RANSAC iterations processed per parallel block.
+const int RANSAC_BLOCK_SIZE = 4096;
+
+/// Validated hypothesis of a RANSAC iteration. Ties are broken by the
+/// iteration index so that the selected hypothesis does not depend on the
+/// order in which the threads finish.
+class RANSACCandidate {
+public:
+    RANSACCandidate(int iteration = -1,
+                    const Eigen::Matrix4d &transformation =
+                            Eigen::Matrix4d::Identity(),
+                    double fitness = 0.0,
+                    double inlier_rmse = 0.0)
+        : iteration_(iteration),
+          transformation_(transformation),
+          fitness_(fitness),
+          inlier_rmse_(inlier_rmse) {}
+
+    bool IsBetterThan(const RANSACCandidate &other) const {
+        if (iteration_ < 0) return false;
+        if (other.iteration_ < 0) return fitness_ > 0.0;
+        if (fitness_ != other.fitness_) return fitness_ > other.fitness_;
+        if (inlier_rmse_ != other.inlier_rmse_) {
+            return inlier_rmse_ < other.inlier_rmse_;
+        }
+        return iteration_ < other.iteration_;
+    }
+
+public:
+    int iteration_;
+    Eigen::Matrix4d_u transformation_;
+    double fitness_;
+    double inlier_rmse_;
+};
+
+uint64_t GetRANSACSeed(const RANSACConvergenceCriteria &criteria) {
+    return criteria.seed_ < 0 ? utility::RandomSeed()
+                              : (uint64_t)criteria.seed_;
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -154,6 +195,22 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RegistrationICP(source, target, kdtree, max_correspondence_distance,
+                           init, estimation, criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -169,8 +226,6 @@ RegistrationResult RegistrationICP(
     }
 
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (init.isIdentity() == false) {
         pcd.Transform(init);
@@ -213,29 +268,50 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
-    Eigen::Matrix4d transformation;
-    CorrespondenceSet ransac_corres(ransac_n);
-    RegistrationResult result;
+    const uint64_t seed = GetRANSACSeed(criteria);
+    const int num_iteration =
+            std::min(criteria.max_iteration_, criteria.max_validation_);
+    RANSACCandidate best;
 
-    for (int itr = 0;
-         itr < criteria.max_iteration_ && itr < criteria.max_validation_;
-         itr++) {
-        for (int j = 0; j < ransac_n; j++) {
-            ransac_corres[j] = corres[utility::UniformRandInt(
-                    0, static_cast<int>(corres.size()) - 1)];
+    for (int block_begin = 0; block_begin < num_iteration;
+         block_begin += RANSAC_BLOCK_SIZE) {
+        int block_size =
+                std::min(RANSAC_BLOCK_SIZE, num_iteration - block_begin);
+        std::vector<RANSACCandidate> candidates(block_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < block_size; k++) {
+            int itr = block_begin + k;
+            utility::RandomStream rng(seed, (uint64_t)itr);
+            CorrespondenceSet ransac_corres(ransac_n);
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] = corres[rng.UniformInt(
+                        0, static_cast<int>(corres.size()) - 1)];
+            }
+            Eigen::Matrix4d transformation = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
+            geometry::PointCloud pcd = source;
+            pcd.Transform(transformation);
+            auto this_result = EvaluateRANSACBasedOnCorrespondence(
+                    pcd, target, corres, max_correspondence_distance,
+                    transformation);
+            candidates[k] = RANSACCandidate(itr, transformation,
+                                            this_result.fitness_,
+                                            this_result.inlier_rmse_);
+        }
+        for (const auto &candidate : candidates) {
+            if (candidate.IsBetterThan(best)) best = candidate;
         }
-        transformation =
-                estimation.ComputeTransformation(source, target, ransac_corres);
+    }
+
+    RegistrationResult result;
+    if (best.iteration_ >= 0) {
         geometry::PointCloud pcd = source;
-        pcd.Transform(transformation);
-        auto this_result = EvaluateRANSACBasedOnCorrespondence(
+        pcd.Transform(best.transformation_);
+        result = EvaluateRANSACBasedOnCorrespondence(
                 pcd, target, corres, max_correspondence_distance,
-                transformation);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-        }
+                best.transformation_);
     }
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
@@ -255,111 +331,142 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
-    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0 ||
+        source.points_.empty() || target.points_.empty()) {
         return RegistrationResult();
     }
 
-    RegistrationResult result;
+    const uint64_t seed = GetRANSACSeed(criteria);
+    const int num_similar_features = 1;
+    const int num_source = static_cast<int>(source.points_.size());
+    geometry::KDTreeFlann kdtree(target);
+    geometry::KDTreeFlann kdtree_feature(target_feature);
+    // Lazily filled cache of the most similar target features of each source
+    // point. Missing entries of a block are gathered first and then filled in
+    // parallel, each entry by exactly one thread.
+    std::vector<std::vector<int>> similar_features(num_source);
+    std::vector<char> similar_features_scheduled(num_source, 0);
     int total_validation = 0;
-    bool finished_validation = false;
-    int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
+    RANSACCandidate best;
+
+    for (int block_begin = 0; block_begin < criteria.max_iteration_ &&
+                              total_validation < criteria.max_validation_;
+         block_begin += RANSAC_BLOCK_SIZE) {
+        int block_size = std::min(RANSAC_BLOCK_SIZE,
+                                  criteria.max_iteration_ - block_begin);
 
+        // Draw the samples of every iteration from its own stream:
+        // (source index, rank among the similar target features).
+        std::vector<Eigen::Vector2i> samples(block_size * ransac_n);
 #ifdef _OPENMP
-#pragma omp parallel
-    {
+#pragma omp parallel for schedule(static)
 #endif
-        CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
-        RegistrationResult result_private;
+        for (int k = 0; k < block_size; k++) {
+            utility::RandomStream rng(seed, (uint64_t)(block_begin + k));
+            for (int j = 0; j < ransac_n; j++) {
+                samples[k * ransac_n + j](0) =
+                        rng.UniformInt(0, num_source - 1);
+                samples[k * ransac_n + j](1) =
+                        num_similar_features == 1
+                                ? 0
+                                : rng.UniformInt(0, num_similar_features - 1);
+            }
+        }
 
+        std::vector<int> missing;
+        for (const auto &sample : samples) {
+            if (!similar_features_scheduled[sample(0)]) {
+                similar_features_scheduled[sample(0)] = 1;
+                missing.push_back(sample(0));
+            }
+        }
 #ifdef _OPENMP
-#pragma omp for nowait
+#pragma omp parallel for schedule(static)
 #endif
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
-                Eigen::Matrix4d transformation;
-                for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id = utility::UniformRandInt(
-                            0, static_cast<int>(source.points_.size()) - 1);
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
+        for (int m = 0; m < (int)missing.size(); m++) {
+            std::vector<int> indices(num_similar_features);
+            std::vector<double> dists(num_similar_features);
+            kdtree_feature.SearchKNN(
+                    Eigen::VectorXd(source_feature.data_.col(missing[m])),
+                    num_similar_features, indices, dists);
+            similar_features[missing[m]] = indices;
+        }
+
+        // Check the samples and estimate their transformations.
+        std::vector<RANSACCandidate> candidates(block_size);
 #ifdef _OPENMP
-#pragma omp critical
+#pragma omp parallel for schedule(static)
 #endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
-                    ransac_corres[j](0) = source_sample_id;
-                    if (num_similar_features == 1)
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
-                    else {
-                        ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
-                    }
-                }
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (checker.get().require_pointcloud_alignment_ == false &&
-                        checker.get().Check(source, target, ransac_corres,
-                                            transformation) == false) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (check == false) continue;
-                transformation = estimation.ComputeTransformation(
-                        source, target, ransac_corres);
-                check = true;
-                for (const auto &checker : checkers) {
-                    if (checker.get().require_pointcloud_alignment_ == true &&
-                        checker.get().Check(source, target, ransac_corres,
-                                            transformation) == false) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (check == false) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto this_result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-                if (this_result.fitness_ > result_private.fitness_ ||
-                    (this_result.fitness_ == result_private.fitness_ &&
-                     this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
-                    result_private = this_result;
+        for (int k = 0; k < block_size; k++) {
+            CorrespondenceSet ransac_corres(ransac_n);
+            for (int j = 0; j < ransac_n; j++) {
+                const auto &sample = samples[k * ransac_n + j];
+                ransac_corres[j](0) = sample(0);
+                ransac_corres[j](1) = similar_features[sample(0)][sample(1)];
+            }
+            Eigen::Matrix4d transformation;
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (checker.get().require_pointcloud_alignment_ == false &&
+                    checker.get().Check(source, target, ransac_corres,
+                                        transformation) == false) {
+                    check = false;
+                    break;
                 }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                {
-                    total_validation = total_validation + 1;
-                    if (total_validation >= criteria.max_validation_)
-                        finished_validation = true;
+            }
+            if (check == false) continue;
+            transformation = estimation.ComputeTransformation(source, target,
+                                                              ransac_corres);
+            for (const auto &checker : checkers) {
+                if (checker.get().require_pointcloud_alignment_ == true &&
+                    checker.get().Check(source, target, ransac_corres,
+                                        transformation) == false) {
+                    check = false;
+                    break;
                 }
-            }  // end of if statement
-        }      // end of for-loop
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (result_private.fitness_ > result.fitness_ ||
-                (result_private.fitness_ == result.fitness_ &&
-                 result_private.inlier_rmse_ < result.inlier_rmse_)) {
-                result = result_private;
+            }
+            if (check == false) continue;
+            candidates[k].iteration_ = block_begin + k;
+            candidates[k].transformation_ = transformation;
+        }
+
+        // Validate the accepted candidates in iteration order until the
+        // validation budget is used up.
+        std::vector<int> validation;
+        for (int k = 0; k < block_size &&
+                        total_validation < criteria.max_validation_;
+             k++) {
+            if (candidates[k].iteration_ >= 0) {
+                validation.push_back(k);
+                total_validation++;
             }
         }
 #ifdef _OPENMP
-    }
+#pragma omp parallel for schedule(dynamic)
 #endif
+        for (int v = 0; v < (int)validation.size(); v++) {
+            auto &candidate = candidates[validation[v]];
+            geometry::PointCloud pcd = source;
+            pcd.Transform(candidate.transformation_);
+            auto this_result = GetRegistrationResultAndCorrespondences(
+                    pcd, target, kdtree, max_correspondence_distance,
+                    candidate.transformation_);
+            candidate.fitness_ = this_result.fitness_;
+            candidate.inlier_rmse_ = this_result.inlier_rmse_;
+        }
+        for (int k : validation) {
+            if (candidates[k].IsBetterThan(best)) best = candidates[k];
+        }
+    }
+
+    RegistrationResult result;
+    if (best.iteration_ >= 0) {
+        geometry::PointCloud pcd = source;
+        pcd.Transform(best.transformation_);
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                best.transformation_);
+    }
     utility::LogDebug("total_validation : {:d}", total_validation);
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
@@ -371,12 +478,23 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
+    geometry::KDTreeFlann target_kdtree(target);
+    return GetInformationMatrixFromPointClouds(source, target, target_kdtree,
+                                               max_correspondence_distance,
+                                               transformation);
+}
+
+Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
     geometry::PointCloud pcd = source;
     if (transformation.isIdentity() == false) {
         pcd.Transform(transformation);
     }
     RegistrationResult result;
-    geometry::KDTreeFlann target_kdtree(target);
     result = GetRegistrationResultAndCorrespondences(
             pcd, target, target_kdtree, max_correspondence_distance,
             transformation);
@@ -37,6 +37,7 @@
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
 }
 
@@ -87,6 +88,10 @@ public:
 /// Note that the validation is the most computational expensive operator in an
 /// iteration. Most iterations do not do full validation. It is crucial to
 /// control max_validation_ so that the computation time is acceptable.
+///
+/// Each iteration draws its samples from its own random stream derived from
+/// seed_, so a non-negative seed_ gives the same result for any number of
+/// threads.
 class RANSACConvergenceCriteria {
 public:
     /// \brief Parameterized Constructor.
@@ -94,9 +99,14 @@ public:
     /// \param max_iteration Maximum iteration before iteration stops.
     /// \param max_validation Maximum times the validation has been run before
     /// the iteration stops.
+    /// \param seed Seed of the random sampling. A negative seed draws a new
+    /// seed for every run.
     RANSACConvergenceCriteria(int max_iteration = 1000,
-                              int max_validation = 1000)
-        : max_iteration_(max_iteration), max_validation_(max_validation) {}
+                              int max_validation = 1000,
+                              int seed = -1)
+        : max_iteration_(max_iteration),
+          max_validation_(max_validation),
+          seed_(seed) {}
     ~RANSACConvergenceCriteria() {}
 
 public:
@@ -104,6 +114,8 @@ public:
     int max_iteration_;
     /// Maximum times the validation has been run before the iteration stops.
     int max_validation_;
+    /// Seed of the random sampling, negative for a non-deterministic seed.
+    int seed_;
 };
 
 /// \class RegistrationResult
@@ -164,6 +176,28 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration with a prebuilt KDTree of the target.
+///
+/// Use this overload when the same target is registered against many sources,
+/// e.g. in RegisterFragments().
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_kdtree KDTree built on the points of \p target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -218,5 +252,18 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation);
 
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_kdtree KDTree built on the points of \p target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. \param transformation The 4x4 transformation matrix to transform
+/// `source` to `target`.
+Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation);
+
 }  // namespace registration
 }  // namespace open3d
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+namespace open3d {
+namespace registration {
+
+enum class RobustKernelType {
+    Unspecified = 0,
+    L2 = 1,
+    Huber = 2,
+    Tukey = 3,
+    Cauchy = 4,
+    GemanMcClure = 5,
+};
+
+/// \class RobustKernel
+///
+/// Base class of the robust loss functions used to down-weight outlier
+/// correspondences in iteratively reweighted least squares (IRLS). The virtual
+/// function Weight() must be implemented in subclasses.
+///
+/// All kernels are functions of the normalized residual r / k, so scaling the
+/// residual by 1 / s is equivalent to using the kernel parameter s * k. This is
+/// what the graduated non-convexity (GNC) schedule in IRLSOption relies on.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+
+public:
+    virtual RobustKernelType GetKernelType() const = 0;
+    /// Returns the IRLS weight w(r) = rho'(r) / r of residual \p residual.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// Plain least squares, every residual has weight 1.
+class L2Loss : public RobustKernel {
+public:
+    RobustKernelType GetKernelType() const override { return type_; }
+    double Weight(double residual) const override;
+
+private:
+    const RobustKernelType type_ = RobustKernelType::L2;
+};
+
+/// \class HuberLoss
+///
+/// Quadratic for |r| <= k, linear beyond.
+class HuberLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Threshold between the quadratic and the linear region.
+    explicit HuberLoss(double k) : k_(k) {}
+
+public:
+    RobustKernelType GetKernelType() const override { return type_; }
+    double Weight(double residual) const override;
+
+public:
+    /// Threshold between the quadratic and the linear region.
+    double k_;
+
+private:
+    const RobustKernelType type_ = RobustKernelType::Huber;
+};
+
+/// \class TukeyLoss
+///
+/// Tukey biweight, residuals with |r| > k have weight 0.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residuals larger than k are rejected.
+    explicit TukeyLoss(double k) : k_(k) {}
+
+public:
+    RobustKernelType GetKernelType() const override { return type_; }
+    double Weight(double residual) const override;
+
+public:
+    /// Residuals larger than k are rejected.
+    double k_;
+
+private:
+    const RobustKernelType type_ = RobustKernelType::Tukey;
+};
+
+/// \class CauchyLoss
+///
+/// Cauchy (Lorentzian) loss, rho(r) = k^2 / 2 * log(1 + (r / k)^2).
+class CauchyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale parameter of the kernel.
+    explicit CauchyLoss(double k) : k_(k) {}
+
+public:
+    RobustKernelType GetKernelType() const override { return type_; }
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter of the kernel.
+    double k_;
+
+private:
+    const RobustKernelType type_ = RobustKernelType::Cauchy;
+};
+
+/// \class GMLoss
+///
+/// Geman-McClure loss, rho(r) = r^2 / 2 / (1 + (r / k)^2).
+class GMLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale parameter of the kernel.
+    explicit GMLoss(double k) : k_(k) {}
+
+public:
+    RobustKernelType GetKernelType() const override { return type_; }
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter of the kernel.
+    double k_;
+
+private:
+    const RobustKernelType type_ = RobustKernelType::GemanMcClure;
+};
+
+/// \class IRLSOption
+///
+/// \brief Options of the iteratively reweighted least squares solver used by
+/// robust transformation estimation.
+///
+/// For a fixed correspondence set, up to \p max_iteration_ weighted
+/// Gauss-Newton steps are taken and the kernel weights are recomputed after
+/// each step. With graduated non-convexity the kernel starts
+/// \p gnc_initial_scale_ times wider than its parameter and is narrowed by
+/// \p gnc_division_factor_ every step until it reaches its nominal width.
+/// The default (a single step, no GNC) reproduces plain weighted
+/// Gauss-Newton.
+class IRLSOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_iteration Maximum number of reweighted steps per call.
+    /// \param gnc_initial_scale Initial kernel scale for graduated
+    /// non-convexity, 1 disables GNC. \param gnc_division_factor Factor the
+    /// kernel scale is divided by after every step. \param min_update The
+    /// solver stops once GNC has finished and the norm of the 6D update is
+    /// below this value.
+    IRLSOption(int max_iteration = 1,
+               double gnc_initial_scale = 1.0,
+               double gnc_division_factor = 1.4,
+               double min_update = 1e-6)
+        : max_iteration_(max_iteration),
+          gnc_initial_scale_(gnc_initial_scale),
+          gnc_division_factor_(gnc_division_factor),
+          min_update_(min_update) {}
+    ~IRLSOption() {}
+
+public:
+    /// Maximum number of reweighted steps per call.
+    int max_iteration_;
+    /// Initial kernel scale for graduated non-convexity, 1 disables GNC.
+    double gnc_initial_scale_;
+    /// Factor the kernel scale is divided by after every step.
+    double gnc_division_factor_;
+    /// Convergence threshold on the norm of the 6D update.
+    double min_update_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include "Open3D/Registration/TransformationEstimation.h"
 
 #include <Eigen/Geometry>
+#include <algorithm>
 
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Eigen.h"
@@ -81,29 +82,65 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || target.HasNormals() == false)
         return Eigen::Matrix4d::Identity();
 
-    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r) {
-        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
-        const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        J_r.block<3, 1>(0, 0) = vs.cross(nt);
-        J_r.block<3, 1>(3, 0) = nt;
+    const auto kernel = kernel_ ? kernel_ : std::make_shared<L2Loss>();
+
+    auto compute_system = [&](const Eigen::Matrix4d &transformation,
+                              double scale) {
+        const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+        const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+        auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
+                                                 double &r, double &w) {
+            const Eigen::Vector3d vs = R * source.points_[corres[i][0]] + t;
+            const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+            const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
+            r = (vs - vt).dot(nt);
+            w = kernel->Weight(r / scale);
+            J_r.block<3, 1>(0, 0) = vs.cross(nt);
+            J_r.block<3, 1>(3, 0) = nt;
+        };
+
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        compute_jacobian_and_residual, (int)corres.size());
+        return std::make_tuple(JTJ, JTr);
     };
 
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    return ComputeTransformationIRLS(compute_system, irls_option_);
+}
 
-    bool is_success;
-    Eigen::Matrix4d extrinsic;
-    std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+Eigen::Matrix4d ComputeTransformationIRLS(
+        const std::function<std::tuple<Eigen::Matrix6d, Eigen::Vector6d>(
+                const Eigen::Matrix4d &, double)> &compute_system,
+        const IRLSOption &option) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    double scale = std::max(option.gnc_initial_scale_, 1.0);
+    const double division_factor = std::max(option.gnc_division_factor_, 1.0);
+    for (int i = 0; i < std::max(option.max_iteration_, 1); i++) {
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        std::tie(JTJ, JTr) = compute_system(transformation, scale);
 
-    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+        bool is_success;
+        Eigen::Matrix4d update;
+        std::tie(is_success, update) =
+                utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+        if (!is_success) {
+            break;
+        }
+        transformation = update * transformation;
+
+        bool gnc_finished = scale <= 1.0;
+        scale = std::max(scale / division_factor, 1.0);
+        if (gnc_finished &&
+            utility::TransformMatrix4dToVector6d(update).norm() <
+                    option.min_update_) {
+            break;
+        }
+    }
+    return transformation;
 }
 
 }  // namespace registration
@@ -27,10 +27,15 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "Open3D/Registration/RobustKernel.h"
+#include "Open3D/Utility/Eigen.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -126,11 +131,22 @@ private:
 /// \class TransformationEstimationPointToPlane
 ///
 /// Class to estimate a transformation for point to plane distance.
+///
+/// Correspondences are weighted by \p kernel_ and the system is solved with
+/// iteratively reweighted least squares according to \p irls_option_.
 class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
     /// \brief Default Constructor.
     TransformationEstimationPointToPlane() {}
     ~TransformationEstimationPointToPlane() override {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kernel Robust kernel used to weight the correspondences.
+    /// \param irls_option Options of the IRLS solver.
+    explicit TransformationEstimationPointToPlane(
+            std::shared_ptr<RobustKernel> kernel,
+            const IRLSOption &irls_option = IRLSOption())
+        : kernel_(std::move(kernel)), irls_option_(irls_option) {}
 
 public:
     TransformationEstimationType GetTransformationEstimationType()
@@ -145,10 +161,29 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel used to weight the correspondences.
+    std::shared_ptr<RobustKernel> kernel_ = std::make_shared<L2Loss>();
+    /// Options of the IRLS solver.
+    IRLSOption irls_option_;
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
 };
 
+/// \brief Function to solve a robust 6D rigid alignment problem with
+/// iteratively reweighted least squares.
+///
+/// \param compute_system Function that linearizes the problem around the
+/// current transformation and returns the weighted JTJ and JTr, given the
+/// current kernel scale (residuals are to be divided by it before the kernel
+/// weight is evaluated). \param option Options of the IRLS solver.
+/// \return The accumulated transformation, identity if the first step fails.
+Eigen::Matrix4d ComputeTransformationIRLS(
+        const std::function<std::tuple<Eigen::Matrix6d, Eigen::Vector6d>(
+                const Eigen::Matrix4d &, double)> &compute_system,
+        const IRLSOption &option);
+
 }  // namespace registration
 }  // namespace open3d
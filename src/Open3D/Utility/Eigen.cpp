@@ -26,6 +26,8 @@
 
 #include "Open3D/Utility/Eigen.h"
 
+#include <algorithm>
+
 #include <Eigen/Geometry>
 #include <Eigen/Sparse>
 
@@ -266,6 +268,110 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
 }
 
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<void(int, VecType &, double &, double &)> f,
+        int iteration_num,
+        bool verbose /*=true*/) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        VecType J_r;
+        double r;
+        double w;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, w);
+            JTJ_private.noalias() += J_r * w * J_r.transpose();
+            JTr_private.noalias() += J_r * w * r;
+            r2_sum_private += w * r * r;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Weighted residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<
+                void(int,
+                     std::vector<VecType, Eigen::aligned_allocator<VecType>> &,
+                     std::vector<double> &,
+                     std::vector<double> &)> f,
+        int iteration_num,
+        bool verbose /*=true*/) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        std::vector<double> r;
+        std::vector<double> w;
+        std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, w);
+            for (int j = 0; j < (int)r.size(); j++) {
+                JTJ_private.noalias() += J_r[j] * w[j] * J_r[j].transpose();
+                JTr_private.noalias() += J_r[j] * w[j] * r[j];
+                r2_sum_private += w[j] * r[j] * r[j];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Weighted residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
 // clang-format off
 template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
         std::function<void(int, Eigen::Vector6d &, double &)> f,
@@ -276,8 +382,55 @@ template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
                            std::vector<Eigen::Vector6d, Vector6d_allocator> &,
                            std::vector<double> &)> f,
         int iteration_num, bool verbose);
+
+template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int, Eigen::Vector6d &, double &, double &)> f,
+        int iteration_num, bool verbose);
+
+template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int,
+                           std::vector<Eigen::Vector6d, Vector6d_allocator> &,
+                           std::vector<double> &,
+                           std::vector<double> &)> f,
+        int iteration_num, bool verbose);
 // clang-format on
 
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
+        const std::vector<Eigen::Vector3d> &points) {
+    const int chunk_size = 4096;
+    // Accumulate relative to the first point to limit cancellation.
+    const Eigen::Vector3d origin = points[0];
+    int num_chunks = ((int)points.size() + chunk_size - 1) / chunk_size;
+    std::vector<Eigen::Vector3d> chunk_sum(num_chunks);
+    std::vector<Eigen::Matrix3d> chunk_outer(num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t begin = (size_t)c * chunk_size;
+        size_t end = std::min(points.size(), begin + chunk_size);
+        Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d outer = Eigen::Matrix3d::Zero();
+        for (size_t i = begin; i < end; i++) {
+            Eigen::Vector3d p = points[i] - origin;
+            sum += p;
+            outer.noalias() += p * p.transpose();
+        }
+        chunk_sum[c] = sum;
+        chunk_outer[c] = outer;
+    }
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d outer = Eigen::Matrix3d::Zero();
+    for (int c = 0; c < num_chunks; c++) {
+        sum += chunk_sum[c];
+        outer += chunk_outer[c];
+    }
+    Eigen::Vector3d mean = sum / (double)points.size();
+    Eigen::Matrix3d covariance =
+            outer / (double)points.size() - mean * mean.transpose();
+    return std::make_tuple(mean + origin, covariance);
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians) {
     Eigen::Matrix3d rot;
     rot << 1, 0, 0, 0, std::cos(radians), -std::sin(radians), 0,
@@ -113,6 +113,38 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Function to compute weighted JTJ and Jtr
+/// Input: function pointer f and total number of rows of Jacobian matrix
+/// Output: JTJ, JTr, sum of w * r^2
+/// Note: f takes index of row, and outputs corresponding residual, row
+/// vector and the weight of the row (e.g. from a robust kernel).
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<void(int, VecType &, double &, double &)> f,
+        int iteration_num,
+        bool verbose = true);
+
+/// Function to compute weighted JTJ and Jtr
+/// Input: function pointer f and total number of rows of Jacobian matrix
+/// Output: JTJ, JTr, sum of w * r^2
+/// Note: f takes index of row, and outputs corresponding residuals, row
+/// vectors and per-residual weights.
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<
+                void(int,
+                     std::vector<VecType, Eigen::aligned_allocator<VecType>> &,
+                     std::vector<double> &,
+                     std::vector<double> &)> f,
+        int iteration_num,
+        bool verbose = true);
+
+/// Computes the mean and covariance of \p points, which must not be empty.
+/// Points are reduced in fixed size chunks whose sums are combined in chunk
+/// order, so the result does not depend on the number of threads.
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
+        const std::vector<Eigen::Vector3d> &points);
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
@@ -26,6 +26,7 @@
 
 #include "Open3D/Utility/Helper.h"
 
+#include <algorithm>
 #include <cctype>
 #include <random>
 #include <unordered_set>
@@ -104,5 +105,73 @@ int UniformRandInt(const int min, const int max) {
     return distribution(generator);
 }
 
+namespace {
+
+// SplitMix64 finalizer, see http://xoshiro.di.unimi.it/splitmix64.c
+uint64_t MixUInt64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}  // unnamed namespace
+
+uint64_t RandomSeed() {
+    std::random_device rd;
+    return (uint64_t(rd()) << 32) ^ uint64_t(rd());
+}
+
+std::vector<size_t> NonZeroIndices(const std::vector<char>& mask) {
+    const size_t block_size = 1 << 16;
+    int num_blocks = int((mask.size() + block_size - 1) / block_size);
+    std::vector<size_t> offsets(num_blocks + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        size_t end = std::min(mask.size(), (b + 1) * block_size);
+        size_t count = 0;
+        for (size_t i = b * block_size; i < end; i++) {
+            if (mask[i]) count++;
+        }
+        offsets[b + 1] = count;
+    }
+    for (int b = 0; b < num_blocks; b++) {
+        offsets[b + 1] += offsets[b];
+    }
+    std::vector<size_t> indices(offsets[num_blocks]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        size_t end = std::min(mask.size(), (b + 1) * block_size);
+        size_t cnt = offsets[b];
+        for (size_t i = b * block_size; i < end; i++) {
+            if (mask[i]) indices[cnt++] = i;
+        }
+    }
+    return indices;
+}
+
+RandomStream::RandomStream(uint64_t seed, uint64_t stream_id)
+    : key_(MixUInt64(seed ^ MixUInt64(stream_id + 0x9e3779b97f4a7c15ULL))),
+      counter_(0) {}
+
+uint64_t RandomStream::NextUInt64() {
+    counter_++;
+    return MixUInt64(key_ + counter_ * 0x9e3779b97f4a7c15ULL);
+}
+
+int RandomStream::UniformInt(int min, int max) {
+    // Multiply-shift mapping of the upper 32 bits onto the range.
+    uint64_t range = uint64_t(int64_t(max) - int64_t(min)) + 1;
+    return int(int64_t(min) + int64_t(((NextUInt64() >> 32) * range) >> 32));
+}
+
+double RandomStream::UniformDouble() {
+    // The upper 53 bits fill the mantissa of a double.
+    return double(NextUInt64() >> 11) * (1.0 / double(uint64_t(1) << 53));
+}
+
 }  // namespace utility
 }  // namespace open3d
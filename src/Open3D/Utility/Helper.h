@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -133,5 +135,73 @@ void Sleep(int milliseconds);
 /// (inclusive)
 int UniformRandInt(const int min, const int max);
 
+/// Function returning a non-deterministic seed drawn from std::random_device.
+uint64_t RandomSeed();
+
+/// Returns the positions of the non-zero entries of \p mask in increasing
+/// order. Fixed size blocks of the mask are counted in parallel, and each
+/// block is then written at the offset given by a prefix sum of the counts.
+std::vector<size_t> NonZeroIndices(const std::vector<char>& mask);
+
+/// Sorts \p values with operator<. Fixed size chunks are sorted in parallel
+/// and merged pairwise, with the merges of each round also running in
+/// parallel.
+template <typename T>
+void ParallelSort(std::vector<T>& values) {
+    const size_t chunk_size = 1 << 16;
+    int num_chunks = int((values.size() + chunk_size - 1) / chunk_size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        size_t end = std::min(values.size(), (c + 1) * chunk_size);
+        std::sort(values.begin() + c * chunk_size, values.begin() + end);
+    }
+    for (size_t width = chunk_size; width < values.size(); width *= 2) {
+        int num_merges = int((values.size() + 2 * width - 1) / (2 * width));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int m = 0; m < num_merges; m++) {
+            size_t begin = m * 2 * width;
+            size_t middle = std::min(values.size(), begin + width);
+            size_t end = std::min(values.size(), begin + 2 * width);
+            std::inplace_merge(values.begin() + begin, values.begin() + middle,
+                               values.begin() + end);
+        }
+    }
+}
+
+/// \class RandomStream
+///
+/// \brief Counter-based pseudo-random number generator.
+///
+/// The n-th number of a stream is a hash of (seed, stream_id, n), so streams
+/// need no shared state. Creating one stream per work item (e.g. per RANSAC
+/// iteration) inside a parallel loop gives the same numbers regardless of the
+/// number of threads and of the scheduling.
+class RandomStream {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param seed Seed shared by all the streams of a computation.
+    /// \param stream_id Index of the stream.
+    RandomStream(uint64_t seed, uint64_t stream_id);
+
+public:
+    /// Returns the next 64 bit pseudo-random number of the stream.
+    uint64_t NextUInt64();
+    /// Returns a pseudo-random integer drawn from a uniform distribution
+    /// bounded by min and max (inclusive).
+    int UniformInt(int min, int max);
+    /// Returns a pseudo-random double drawn from a uniform distribution
+    /// in [0, 1).
+    double UniformDouble();
+
+private:
+    uint64_t key_;
+    uint64_t counter_;
+};
+
 }  // namespace utility
 }  // namespace open3d
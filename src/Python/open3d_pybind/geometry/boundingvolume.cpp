@@ -70,7 +70,7 @@ void pybind_boundingvolume(py::module &m) {
                     "create_from_points",
                     &geometry::OrientedBoundingBox::CreateFromPoints,
                     "Creates the bounding box that encloses the set of points.",
-                    "points"_a)
+                    "points"_a, "use_convex_hull"_a = true)
             .def("volume", &geometry::OrientedBoundingBox::Volume,
                  "Returns the volume of the bounding box.")
             .def("get_box_points", &geometry::OrientedBoundingBox::GetBoxPoints,
@@ -93,9 +93,12 @@ void pybind_boundingvolume(py::module &m) {
             {{"aabox",
               "AxisAlignedBoundingBox object from which OrientedBoundingBox is "
               "created."}});
-    docstring::ClassMethodDocInject(m, "OrientedBoundingBox",
-                                    "create_from_points",
-                                    {{"points", "A list of points."}});
+    docstring::ClassMethodDocInject(
+            m, "OrientedBoundingBox", "create_from_points",
+            {{"points", "A list of points."},
+             {"use_convex_hull",
+              "If ``True``, the PCA is computed on the convex hull vertices. "
+              "If ``False``, all points are used and no hull is computed."}});
 
     py::class_<geometry::AxisAlignedBoundingBox,
                PyGeometry3D<geometry::AxisAlignedBoundingBox>,
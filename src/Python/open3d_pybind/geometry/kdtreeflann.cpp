@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -118,6 +120,9 @@ void pybind_kdtreeflann(py::module &m) {
                     {"max_nn",
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
+                    {"max_count",
+                     "If positive, counting stops once ``max_count`` points "
+                     "are found."},
                     {"feature", "Feature data."},
                     {"data", "Matrix data."}};
     py::class_<geometry::KDTreeFlann, std::shared_ptr<geometry::KDTreeFlann>>
@@ -250,7 +255,37 @@ void pybind_kdtreeflann(py::module &m) {
                                  "search_hybrid_vector_xd() error!");
                      return std::make_tuple(k, indices, distance2);
                  },
-                 "query"_a, "radius"_a, "max_nn"_a);
+                 "query"_a, "radius"_a, "max_nn"_a)
+            .def("count_radius_vector_3d",
+                 [](const geometry::KDTreeFlann &tree,
+                    const Eigen::Vector3d &query, double radius,
+                    int max_count) {
+                     int k = tree.CountRadius(query, radius, max_count);
+                     if (k < 0)
+                         throw std::runtime_error(
+                                 "count_radius_vector_3d() error!");
+                     return k;
+                 },
+                 "Counts the points within radius of the query point "
+                 "without returning them.",
+                 "query"_a, "radius"_a, "max_count"_a = -1)
+            .def("count_radius_vector_xd",
+                 [](const geometry::KDTreeFlann &tree,
+                    const Eigen::VectorXd &query, double radius,
+                    int max_count) {
+                     int k = tree.CountRadius(query, radius, max_count);
+                     if (k < 0)
+                         throw std::runtime_error(
+                                 "count_radius_vector_xd() error!");
+                     return k;
+                 },
+                 "Counts the points within radius of the query point "
+                 "without returning them.",
+                 "query"_a, "radius"_a, "max_count"_a = -1);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "count_radius_vector_3d",
+                                    map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "count_radius_vector_xd",
+                                    map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_3d",
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_xd",
@@ -273,4 +308,61 @@ void pybind_kdtreeflann(py::module &m) {
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_matrix_data",
                                     map_kd_tree_flann_method_docs);
+
+    // open3d.geometry.NeighborhoodGraph
+    py::class_<geometry::NeighborhoodGraph,
+               std::shared_ptr<geometry::NeighborhoodGraph>>
+            neighborhood(m, "NeighborhoodGraph",
+                         "Neighbors of every point of a point cloud, stored "
+                         "in compressed sparse row form.");
+    neighborhood.def(py::init<>())
+            .def(py::init<const geometry::PointCloud &,
+                          const geometry::KDTreeSearchParam &>(),
+                 "cloud"_a, "search_param"_a)
+            .def("compute_neighborhood",
+                 static_cast<bool (geometry::NeighborhoodGraph::*)(
+                         const geometry::PointCloud &,
+                         const geometry::KDTreeSearchParam &)>(
+                         &geometry::NeighborhoodGraph::ComputeNeighborhood),
+                 "Computes the neighborhoods of all points of the point "
+                 "cloud.",
+                 "cloud"_a, "search_param"_a)
+            .def("clear", &geometry::NeighborhoodGraph::Clear,
+                 "Removes all neighborhoods.")
+            .def("num_points", &geometry::NeighborhoodGraph::NumPoints,
+                 "Returns the number of points in the graph.")
+            .def("get_neighbors",
+                 [](const geometry::NeighborhoodGraph &graph, size_t i) {
+                     if (i >= graph.NumPoints())
+                         throw std::out_of_range("get_neighbors() error!");
+                     const int *indices = graph.NeighborIndices(i);
+                     const double *distance2 = graph.NeighborDistance2(i);
+                     int k = graph.NumNeighbors(i);
+                     return std::make_tuple(
+                             std::vector<int>(indices, indices + k),
+                             std::vector<double>(distance2, distance2 + k));
+                 },
+                 "Returns the neighbor indices and squared distances of "
+                 "point i.",
+                 "i"_a)
+            .def_readonly("offsets", &geometry::NeighborhoodGraph::offsets_,
+                          "Row offsets, of size num_points() + 1.")
+            .def_readonly("indices", &geometry::NeighborhoodGraph::indices_,
+                          "Neighbor indices of all points, concatenated.")
+            .def_readonly("distance2",
+                          &geometry::NeighborhoodGraph::distance2_,
+                          "Squared neighbor distances, parallel to indices.")
+            .def("__repr__", [](const geometry::NeighborhoodGraph &graph) {
+                return std::string("geometry::NeighborhoodGraph with ") +
+                       std::to_string(graph.NumPoints()) + " points and " +
+                       std::to_string(graph.indices_.size()) + " neighbors.";
+            });
+    docstring::ClassMethodDocInject(
+            m, "NeighborhoodGraph", "compute_neighborhood",
+            {{"cloud", "The point cloud whose neighborhoods are computed."},
+             {"search_param", "KNN, radius or hybrid search parameters."}});
+    docstring::ClassMethodDocInject(m, "NeighborhoodGraph", "clear");
+    docstring::ClassMethodDocInject(m, "NeighborhoodGraph", "num_points");
+    docstring::ClassMethodDocInject(m, "NeighborhoodGraph", "get_neighbors",
+                                    {{"i", "Index of the point."}});
 }
@@ -28,6 +28,7 @@
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
 
@@ -71,6 +72,11 @@ void pybind_pointcloud(py::module &m) {
                  "Function to select points from input pointcloud into output "
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
+            .def("select_by_index_in_place",
+                 &geometry::PointCloud::SelectByIndexInPlace,
+                 "Function to keep only the selected points of the "
+                 "pointcloud, compacting it in place.",
+                 "indices"_a, "invert"_a = false)
             .def("voxel_down_sample", &geometry::PointCloud::VoxelDownSample,
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
@@ -119,12 +125,23 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
-            .def("estimate_normals", &geometry::PointCloud::EstimateNormals,
+            .def("estimate_normals",
+                 static_cast<bool (geometry::PointCloud::*)(
+                         const geometry::KDTreeSearchParam &, bool)>(
+                         &geometry::PointCloud::EstimateNormals),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = geometry::KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals_with_neighborhood",
+                 static_cast<bool (geometry::PointCloud::*)(
+                         const geometry::NeighborhoodGraph &, bool)>(
+                         &geometry::PointCloud::EstimateNormals),
+                 "Function to compute the normals of a point cloud from "
+                 "precomputed neighborhoods. Normals are oriented with "
+                 "respect to the input point cloud if normals exist",
+                 "neighborhood"_a, "fast_normal_computation"_a = true)
             .def("orient_normals_to_align_with_direction",
                  &geometry::PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -133,12 +150,30 @@ void pybind_pointcloud(py::module &m) {
                  &geometry::PointCloud::OrientNormalsTowardsCameraLocation,
                  "Function to orient the normals of a point cloud",
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
+            .def("orient_normals_consistent_tangent_plane",
+                 &geometry::PointCloud::OrientNormalsConsistentTangentPlane,
+                 "Function to consistently orient the normals of a point "
+                 "cloud by propagating them along a minimum spanning tree of "
+                 "the k nearest neighbor graph",
+                 "k"_a)
             .def("compute_point_cloud_distance",
-                 &geometry::PointCloud::ComputePointCloudDistance,
+                 static_cast<std::vector<double> (geometry::PointCloud::*)(
+                         const geometry::PointCloud &)>(
+                         &geometry::PointCloud::ComputePointCloudDistance),
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
                  "target"_a)
+            .def("compute_point_cloud_distance_and_indices",
+                 static_cast<std::tuple<std::vector<double>, std::vector<int>> (
+                         geometry::PointCloud::*)(const geometry::PointCloud &,
+                                                  double, bool) const>(
+                         &geometry::PointCloud::ComputePointCloudDistance),
+                 "For each point in the source point cloud, compute the "
+                 "distance to and the index of the nearest target point "
+                 "at a distance less than max_distance. Points without such "
+                 "a neighbor get distance inf and index -1.",
+                 "target"_a, "max_distance"_a, "use_grid"_a = false)
             .def("compute_mean_and_covariance",
                  &geometry::PointCloud::ComputeMeanAndCovariance,
                  "Function to compute the mean and covariance matrix of a "
@@ -166,16 +201,38 @@ void pybind_pointcloud(py::module &m) {
                  "found in Mehra et. al. 'Visibility of Noisy Point Cloud "
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
+            .def("hidden_point_removal_by_sectors",
+                 &geometry::PointCloud::HiddenPointRemovalBySectors,
+                 "Approximate hidden point removal that computes one convex "
+                 "hull per sector of viewing directions, in parallel. Returns "
+                 "the indices of the visible points.",
+                 "camera_location"_a, "radius"_a, "sector_resolution"_a = 4)
+            .def("hidden_point_removal_z_buffer",
+                 &geometry::PointCloud::HiddenPointRemovalZBuffer,
+                 "Approximate visibility from a pinhole camera using a "
+                 "z-buffer. Returns the indices of the visible points.",
+                 "intrinsic"_a, "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "depth_tolerance"_a = 0.01)
             .def("cluster_dbscan", &geometry::PointCloud::ClusterDBSCAN,
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
-                 "eps"_a, "min_points"_a, "print_progress"_a = false)
+                 "eps"_a, "min_points"_a, "print_progress"_a = false,
+                 "use_grid"_a = false)
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &geometry::PointCloud::SegmentPlanes,
+                 "Segments up to max_num_planes planes in the point cloud "
+                 "using the RANSAC algorithm. The inliers of each plane are "
+                 "removed before the next plane is searched. Returns a list "
+                 "of (plane_model, inliers) tuples.",
+                 "max_num_planes"_a, "distance_threshold"_a = 0.01,
+                 "ransac_n"_a = 3, "num_iterations"_a = 100,
+                 "min_num_inliers"_a = 3, "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
@@ -202,6 +259,21 @@ void pybind_pointcloud(py::module &m) {
                         "image"_a, "intrinsic"_a,
                         "extrinsic"_a = Eigen::Matrix4d::Identity(),
                         "project_valid_depth_only"_a = true)
+            .def("update_from_depth_image",
+                 &geometry::PointCloud::UpdateFromDepthImage,
+                 "Function to unproject a depth image into this point cloud, "
+                 "reusing its buffers",
+                 "depth"_a, "intrinsic"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0,
+                 "stride"_a = 1, "project_valid_depth_only"_a = true)
+            .def("update_from_rgbd_image",
+                 &geometry::PointCloud::UpdateFromRGBDImage,
+                 "Function to unproject an RGB-D image into this point cloud, "
+                 "reusing its buffers",
+                 "image"_a, "intrinsic"_a,
+                 "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                 "project_valid_depth_only"_a = true)
             .def_readwrite("points", &geometry::PointCloud::points_,
                            "``float64`` array of shape ``(num_points, 3)``, "
                            "use ``numpy.asarray()`` to access data: Points "
@@ -227,6 +299,11 @@ void pybind_pointcloud(py::module &m) {
             {{"indices", "Indices of points to be selected."},
              {"invert",
               "Set to ``True`` to invert the selection of indices."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "select_by_index_in_place",
+            {{"indices", "Indices of points to be selected."},
+             {"invert",
+              "Set to ``True`` to invert the selection of indices."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -264,6 +341,14 @@ void pybind_pointcloud(py::module &m) {
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
               "faster, but is not as numerical stable."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "estimate_normals_with_neighborhood",
+            {{"neighborhood",
+              "Neighborhoods of all points of the point cloud."},
+             {"fast_normal_computation",
+              "If true, the normal estiamtion uses a non-iterative method to "
+              "extract the eigenvector from the covariance matrix. This is "
+              "faster, but is not as numerical stable."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "orient_normals_to_align_with_direction",
             {{"orientation_reference",
@@ -272,9 +357,20 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "orient_normals_towards_camera_location",
             {{"camera_location",
               "Normals are oriented with towards the camera_location."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "orient_normals_consistent_tangent_plane",
+            {{"k", "Number of nearest neighbors used to build the graph."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_point_cloud_distance",
                                     {{"target", "The target point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_point_cloud_distance_and_indices",
+            {{"target", "The target point cloud."},
+             {"max_distance",
+              "Search cutoff, a non-positive value disables it."},
+             {"use_grid",
+              "If true and a cutoff is given, a uniform hash grid with cell "
+              "size max_distance is used instead of a KDTree."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_mean_and_covariance");
     docstring::ClassMethodDocInject(m, "PointCloud",
@@ -289,13 +385,31 @@ void pybind_pointcloud(py::module &m) {
              {"camera_location",
               "All points not visible from that location will be reomved"},
              {"radius", "The radius of the sperical projection"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "hidden_point_removal_by_sectors",
+            {{"camera_location",
+              "All points not visible from that location will be removed"},
+             {"radius", "The radius of the sperical projection"},
+             {"sector_resolution",
+              "Number of sectors along each side of a cube map face."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "hidden_point_removal_z_buffer",
+            {{"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"depth_tolerance",
+              "Relative depth difference below which a point is considered "
+              "to be on the visible surface."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "cluster_dbscan",
             {{"eps",
               "Density parameter that is used to find neighbouring points."},
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
-              "If true the progress is visualized in the console."}});
+              "If true the progress is visualized in the console."},
+             {"use_grid",
+              "If true the neighbourhoods are not stored: points are bucketed "
+              "in a grid of cell size eps and clusters are merged in parallel "
+              "with union-find. Memory is linear in the number of points."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "segment_plane",
             {{"distance_threshold",
@@ -304,7 +418,24 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The "
+              "iterations stop early once it is reached."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"max_num_planes", "Maximum number of planes to extract."},
+             {"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"min_num_inliers",
+              "Extraction stops when a plane has fewer inliers."},
+             {"probability",
+              "Expected probability of finding the optimal plane."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -321,6 +452,26 @@ void pybind_pointcloud(py::module &m) {
             {{"image", "The input image."},
              {"intrinsic", "Intrinsic parameters of the camera."},
              {"extrnsic", "Extrinsic parameters of the camera."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "update_from_depth_image",
+            {{"depth",
+              "The input depth image can be either a float image, or a "
+              "uint16_t image."},
+             {"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"depth_scale", "The depth is scaled by 1 / depth_scale."},
+             {"depth_trunc", "Truncated at depth_trunc distance."},
+             {"stride",
+              "Sampling factor to support coarse point cloud extraction."},
+             {"project_valid_depth_only",
+              "If false, invalid depth results in NaN points."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "update_from_rgbd_image",
+            {{"image", "The input image."},
+             {"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"project_valid_depth_only",
+              "If false, invalid depth results in NaN points."}});
 }
 
 void pybind_pointcloud_methods(py::module &m) {}
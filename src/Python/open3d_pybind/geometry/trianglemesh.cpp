@@ -27,6 +27,10 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/TriangleMeshLOD.h"
+#include "Open3D/Geometry/VertexAdjacency.h"
+#include "Open3D/Geometry/VertexClustering.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -102,6 +106,15 @@ void pybind_trianglemesh(py::module &m) {
                  "that references a single vertex multiple times in a single "
                  "triangle. They are usually the product of removing "
                  "duplicated vertices.")
+            .def("clean_mesh", &geometry::TriangleMesh::CleanMesh,
+                 "Function that removes duplicated vertices, degenerate "
+                 "triangles, duplicated triangles and unreferenced vertices "
+                 "in a single parallel pass. The result is the same as "
+                 "calling the individual functions in this order.",
+                 "remove_duplicated_vertices"_a = true,
+                 "remove_degenerate_triangles"_a = true,
+                 "remove_duplicated_triangles"_a = true,
+                 "remove_unreferenced_vertices"_a = true)
             .def("remove_non_manifold_edges",
                  &geometry::TriangleMesh::RemoveNonManifoldEdges,
                  "Function that removes all non-manifold edges, by "
@@ -125,7 +138,8 @@ void pybind_trianglemesh(py::module &m) {
                  ":math:`v_o = v_i x strength (v_i * |N| - \\sum_{n \\in N} "
                  "v_n)`",
                  "number_of_iterations"_a = 1, "strength"_a = 1,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
             .def("filter_smooth_simple",
                  &geometry::TriangleMesh::FilterSmoothSimple,
                  "Function to smooth triangle mesh with simple neighbour "
@@ -134,7 +148,8 @@ void pybind_trianglemesh(py::module &m) {
                  ":math:`v_o` the output value, and :math:`N` is the set of "
                  "adjacent neighbours.",
                  "number_of_iterations"_a = 1,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
             .def("filter_smooth_laplacian",
                  &geometry::TriangleMesh::FilterSmoothLaplacian,
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
@@ -145,7 +160,9 @@ void pybind_trianglemesh(py::module &m) {
                  "inverse distance (closer neighbours have higher weight), and "
                  "lambda is the smoothing parameter.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "use_cotangent_weights"_a = false,
+                 "vertex_indices"_a = std::vector<size_t>())
             .def("filter_smooth_taubin",
                  &geometry::TriangleMesh::FilterSmoothTaubin,
                  "Function to smooth triangle mesh using method of Taubin, "
@@ -155,7 +172,9 @@ void pybind_trianglemesh(py::module &m) {
                  "parameter mu as smoothing parameter. This method avoids "
                  "shrinkage of the triangle mesh.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5, "mu"_a = -0.53,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "use_cotangent_weights"_a = false,
+                 "vertex_indices"_a = std::vector<size_t>())
             .def("has_vertices", &geometry::TriangleMesh::HasVertices,
                  "Returns ``True`` if the mesh contains vertices.")
             .def("has_triangles", &geometry::TriangleMesh::HasTriangles,
@@ -226,6 +245,17 @@ void pybind_trianglemesh(py::module &m) {
                  "``indices``: "
                  "Indices of vertices to be selected.",
                  "indices"_a)
+            .def("select_by_index_in_place",
+                 &geometry::TriangleMesh::SelectByIndexInPlace,
+                 "Function to keep only the selected vertices and the "
+                 "triangles between them, compacting the mesh in place.",
+                 "indices"_a)
+            .def("compute_closest_points",
+                 &geometry::TriangleMesh::ComputeClosestPoints,
+                 "Function that computes the closest points on the mesh, and "
+                 "their (signed) distances, for a batch of query points.",
+                 "queries"_a, "signed_distance"_a = false,
+                 "max_distance"_a = std::numeric_limits<double>::infinity())
             .def("crop",
                  (std::shared_ptr<geometry::TriangleMesh>(
                          geometry::TriangleMesh::*)(
@@ -280,7 +310,8 @@ void pybind_trianglemesh(py::module &m) {
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
-                 "target_number_of_triangles"_a)
+                 "target_number_of_triangles"_a,
+                 "use_independent_sets"_a = false)
             .def("compute_convex_hull",
                  &geometry::TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
@@ -528,6 +559,18 @@ void pybind_trianglemesh(py::module &m) {
                                     "remove_unreferenced_vertices");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_degenerate_triangles");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "clean_mesh",
+            {{"remove_duplicated_vertices",
+              "Merge vertices with identical coordinates."},
+             {"remove_degenerate_triangles",
+              "Remove triangles that reference a vertex more than once."},
+             {"remove_duplicated_triangles",
+              "Remove triangles that reference the same three vertices as an "
+              "earlier triangle with the same orientation."},
+             {"remove_unreferenced_vertices",
+              "Remove vertices that are not referenced by any remaining "
+              "triangle."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_non_manifold_edges");
     docstring::ClassMethodDocInject(
@@ -539,28 +582,54 @@ void pybind_trianglemesh(py::module &m) {
             {{"number_of_iterations",
               " Number of repetitions of this operation"},
              {"strengh", "Filter parameter."},
-             {"scope", "Mesh property that should be filtered."}});
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Vertices to filter, all vertices if empty."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "filter_smooth_simple",
             {{"number_of_iterations",
               " Number of repetitions of this operation"},
-             {"scope", "Mesh property that should be filtered."}});
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Vertices to filter, all vertices if empty."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "filter_smooth_laplacian",
             {{"number_of_iterations",
               " Number of repetitions of this operation"},
              {"lambda", "Filter parameter."},
-             {"scope", "Mesh property that should be filtered."}});
+             {"scope", "Mesh property that should be filtered."},
+             {"use_cotangent_weights",
+              "Weight the neighbours by cotangent weights instead of by "
+              "inverse distance."},
+             {"vertex_indices",
+              "Vertices to filter, all vertices if empty."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "filter_smooth_taubin",
             {{"number_of_iterations",
               " Number of repetitions of this operation"},
              {"lambda", "Filter parameter."},
              {"mu", "Filter parameter."},
-             {"scope", "Mesh property that should be filtered."}});
+             {"scope", "Mesh property that should be filtered."},
+             {"use_cotangent_weights",
+              "Weight the neighbours by cotangent weights instead of by "
+              "inverse distance."},
+             {"vertex_indices",
+              "Vertices to filter, all vertices if empty."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "select_by_index",
             {{"indices", "Indices of vertices to be selected."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "select_by_index_in_place",
+            {{"indices", "Indices of vertices to be selected."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "compute_closest_points",
+            {{"queries", "The query points."},
+             {"signed_distance",
+              "If ``True``, distances of queries inside the mesh are "
+              "negative. Requires a closed, consistently oriented mesh."},
+             {"max_distance",
+              "Queries further away than this from every triangle get an "
+              "infinite distance and triangle index -1."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "crop",
             {{"bounding_box", "AxisAlignedBoundingBox to crop points"}});
@@ -615,7 +684,12 @@ void pybind_trianglemesh(py::module &m) {
             m, "TriangleMesh", "simplify_quadric_decimation",
             {{"target_number_of_triangles",
               "The number of triangles that the simplified mesh should have. "
-              "It is not guranteed that this number will be reached."}});
+              "It is not guranteed that this number will be reached."},
+             {"use_independent_sets",
+              "If ``True``, collapses rounds of independent edges in "
+              "parallel instead of one edge at a time. Every round passes "
+              "over the whole mesh, so this is slower than the default on a "
+              "single thread."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -776,6 +850,290 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Moebius strip."},
              {"width", "Width of the Moebius strip."},
              {"scale", "Scale the complete Moebius strip."}});
+
+    // open3d.geometry.ClosestPointResult
+    py::class_<geometry::ClosestPointResult,
+               std::shared_ptr<geometry::ClosestPointResult>>
+            closest_point_result(m, "ClosestPointResult",
+                                 "Closest points on a triangle mesh for a "
+                                 "batch of query points.");
+    closest_point_result.def(py::init<>())
+            .def_readwrite("distances",
+                           &geometry::ClosestPointResult::distances_,
+                           "Distance of every query to the mesh, negative "
+                           "inside the mesh for signed queries.")
+            .def_readwrite("points", &geometry::ClosestPointResult::points_,
+                           "Closest point on the mesh for every query.")
+            .def_readwrite("triangle_indices",
+                           &geometry::ClosestPointResult::triangle_indices_,
+                           "Index of the triangle containing the closest "
+                           "point, or -1.")
+            .def_readwrite(
+                    "barycentric_coordinates",
+                    &geometry::ClosestPointResult::barycentric_coordinates_,
+                    "Barycentric coordinates of the closest point within its "
+                    "triangle.")
+            .def("__repr__", [](const geometry::ClosestPointResult &result) {
+                return std::string("geometry::ClosestPointResult with ") +
+                       std::to_string(result.distances_.size()) + " queries.";
+            });
+
+    // open3d.geometry.TriangleMeshBVH
+    py::class_<geometry::TriangleMeshBVH,
+               std::shared_ptr<geometry::TriangleMeshBVH>>
+            bvh(m, "TriangleMeshBVH",
+                "Bounding volume hierarchy over the triangles of a triangle "
+                "mesh.");
+    bvh.def(py::init<>())
+            .def(py::init<const geometry::TriangleMesh &>(), "mesh"_a)
+            .def("set_triangle_mesh",
+                 &geometry::TriangleMeshBVH::SetTriangleMesh,
+                 "Builds the hierarchy over the triangles of the mesh.",
+                 "mesh"_a)
+            .def("clear", &geometry::TriangleMeshBVH::Clear,
+                 "Removes all triangles and nodes.")
+            .def("num_triangles", &geometry::TriangleMeshBVH::NumTriangles,
+                 "Returns the number of triangles in the hierarchy.")
+            .def("query_bounding_box",
+                 &geometry::TriangleMeshBVH::QueryBoundingBox,
+                 "Returns the indices of the triangles whose bounding box "
+                 "intersects the given box.",
+                 "min_bound"_a, "max_bound"_a)
+            .def("cast_ray",
+                 [](const geometry::TriangleMeshBVH &bvh,
+                    const Eigen::Vector3d &origin,
+                    const Eigen::Vector3d &direction, double max_t) {
+                     double t;
+                     int tidx = bvh.CastRay(origin, direction, t, max_t);
+                     return std::make_tuple(tidx, t);
+                 },
+                 "Returns the index of the first triangle hit by the ray, or "
+                 "-1, and the ray parameter of the hit.",
+                 "origin"_a, "direction"_a,
+                 "max_t"_a = std::numeric_limits<double>::infinity())
+            .def("compute_closest_point",
+                 [](const geometry::TriangleMeshBVH &bvh,
+                    const Eigen::Vector3d &query, double max_distance) {
+                     Eigen::Vector3d closest_point(0, 0, 0);
+                     double distance2;
+                     int tidx = bvh.ComputeClosestPoint(query, closest_point,
+                                                        distance2,
+                                                        max_distance);
+                     return std::make_tuple(tidx, closest_point, distance2);
+                 },
+                 "Returns the index of the triangle containing the closest "
+                 "point, or -1, the closest point and its squared distance.",
+                 "query"_a,
+                 "max_distance"_a = std::numeric_limits<double>::infinity())
+            .def("compute_closest_points",
+                 &geometry::TriangleMeshBVH::ComputeClosestPoints,
+                 "Finds the closest points on the mesh for a batch of "
+                 "queries, in parallel.",
+                 "queries"_a, "signed_distance"_a = false,
+                 "max_distance"_a = std::numeric_limits<double>::infinity())
+            .def("compute_self_intersections",
+                 &geometry::TriangleMeshBVH::ComputeSelfIntersections,
+                 "Returns all pairs of intersecting triangles that do not "
+                 "share a vertex.")
+            .def("is_intersecting", &geometry::TriangleMeshBVH::IsIntersecting,
+                 "Returns True if any triangle of the mesh intersects a "
+                 "triangle of the hierarchy.",
+                 "mesh"_a)
+            .def("__repr__", [](const geometry::TriangleMeshBVH &bvh) {
+                return std::string("geometry::TriangleMeshBVH with ") +
+                       std::to_string(bvh.NumTriangles()) + " triangles.";
+            });
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "set_triangle_mesh",
+                                    {{"mesh", "The triangle mesh."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "clear");
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "num_triangles");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "query_bounding_box",
+            {{"min_bound", "Minimum bound of the query box."},
+             {"max_bound", "Maximum bound of the query box."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "cast_ray",
+            {{"origin", "Origin of the ray."},
+             {"direction", "Direction of the ray, not necessarily normalized."},
+             {"max_t", "Hits beyond this ray parameter are ignored."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "compute_closest_point",
+            {{"query", "The query point."},
+             {"max_distance",
+              "Triangles further away than this are ignored."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "compute_closest_points",
+            {{"queries", "The query points."},
+             {"signed_distance",
+              "If ``True``, distances of queries inside the mesh are "
+              "negative. Requires a closed, consistently oriented mesh."},
+             {"max_distance",
+              "Queries further away than this from every triangle get an "
+              "infinite distance and triangle index -1."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH",
+                                    "compute_self_intersections");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "is_intersecting",
+            {{"mesh", "The triangle mesh tested against the hierarchy."}});
+
+    // open3d.geometry.VertexAdjacency
+    py::class_<geometry::VertexAdjacency,
+               std::shared_ptr<geometry::VertexAdjacency>>
+            adjacency(m, "VertexAdjacency",
+                      "Vertex adjacency of a triangle mesh, stored in "
+                      "compressed sparse row form.");
+    adjacency.def(py::init<>())
+            .def(py::init<const geometry::TriangleMesh &>(), "mesh"_a)
+            .def("compute_from_triangle_mesh",
+                 &geometry::VertexAdjacency::ComputeFromTriangleMesh,
+                 "Computes the adjacency of the mesh, using its adjacency "
+                 "list if it has one.",
+                 "mesh"_a)
+            .def("to_adjacency_list",
+                 &geometry::VertexAdjacency::ToAdjacencyList,
+                 "Returns the adjacency as a list of sets.")
+            .def("clear", &geometry::VertexAdjacency::Clear,
+                 "Removes all rows.")
+            .def("num_vertices", &geometry::VertexAdjacency::NumVertices,
+                 "Returns the number of vertices in the adjacency.")
+            .def("get_neighbors",
+                 [](const geometry::VertexAdjacency &adjacency, size_t i) {
+                     if (i >= adjacency.NumVertices())
+                         throw std::out_of_range("get_neighbors() error!");
+                     const int *indices = adjacency.NeighborIndices(i);
+                     return std::vector<int>(
+                             indices, indices + adjacency.NumNeighbors(i));
+                 },
+                 "Returns the sorted neighbor indices of vertex i.", "i"_a)
+            .def_readonly("offsets", &geometry::VertexAdjacency::offsets_,
+                          "Row offsets, of size num_vertices() + 1.")
+            .def_readonly("indices", &geometry::VertexAdjacency::indices_,
+                          "Neighbor indices of all vertices, concatenated.")
+            .def("__repr__", [](const geometry::VertexAdjacency &adjacency) {
+                return std::string("geometry::VertexAdjacency with ") +
+                       std::to_string(adjacency.NumVertices()) +
+                       " vertices and " +
+                       std::to_string(adjacency.indices_.size()) +
+                       " neighbors.";
+            });
+    docstring::ClassMethodDocInject(
+            m, "VertexAdjacency", "compute_from_triangle_mesh",
+            {{"mesh", "The triangle mesh whose adjacency is computed."}});
+    docstring::ClassMethodDocInject(m, "VertexAdjacency", "to_adjacency_list");
+    docstring::ClassMethodDocInject(m, "VertexAdjacency", "clear");
+    docstring::ClassMethodDocInject(m, "VertexAdjacency", "num_vertices");
+    docstring::ClassMethodDocInject(m, "VertexAdjacency", "get_neighbors",
+                                    {{"i", "Index of the vertex."}});
+
+    // open3d.geometry.VertexClustering
+    py::class_<geometry::VertexClustering,
+               std::shared_ptr<geometry::VertexClustering>>
+            clustering(m, "VertexClustering",
+                       "Vertex clustering simplification of a mesh that "
+                       "arrives in chunks.");
+    clustering
+            .def(py::init<double, geometry::MeshBase::SimplificationContraction,
+                          const Eigen::Vector3d &>(),
+                 "voxel_size"_a,
+                 "contraction"_a =
+                         geometry::MeshBase::SimplificationContraction::Average,
+                 "origin"_a = Eigen::Vector3d::Zero())
+            .def("add_mesh", &geometry::VertexClustering::AddMesh,
+                 "Adds the vertices and triangles of the mesh to the "
+                 "clusters.",
+                 "mesh"_a)
+            .def("extract_triangle_mesh",
+                 &geometry::VertexClustering::ExtractTriangleMesh,
+                 "Returns the simplified mesh of everything added so far.")
+            .def("reset", &geometry::VertexClustering::Reset,
+                 "Removes all clusters and triangles.")
+            .def("num_clusters", &geometry::VertexClustering::NumClusters,
+                 "Returns the number of occupied voxels.")
+            .def_readonly("voxel_size",
+                          &geometry::VertexClustering::voxel_size_,
+                          "Size of the voxels within which vertices are "
+                          "pooled.")
+            .def_readonly("origin", &geometry::VertexClustering::origin_,
+                          "Corner of the voxel with index (0, 0, 0).")
+            .def("__repr__", [](const geometry::VertexClustering &clustering) {
+                return std::string("geometry::VertexClustering with ") +
+                       std::to_string(clustering.NumClusters()) +
+                       " clusters.";
+            });
+    docstring::ClassMethodDocInject(
+            m, "VertexClustering", "add_mesh",
+            {{"mesh", "The mesh, or chunk of a mesh, to add."}});
+    docstring::ClassMethodDocInject(m, "VertexClustering",
+                                    "extract_triangle_mesh");
+    docstring::ClassMethodDocInject(m, "VertexClustering", "reset");
+    docstring::ClassMethodDocInject(m, "VertexClustering", "num_clusters");
+
+    // open3d.geometry.TriangleMeshLOD
+    py::class_<geometry::TriangleMeshLOD,
+               std::shared_ptr<geometry::TriangleMeshLOD>>
+            lod(m, "TriangleMeshLOD",
+                "Level of detail hierarchy of a triangle mesh, optionally "
+                "split into tiles.");
+    py::detail::bind_default_constructor<geometry::TriangleMeshLOD>(lod);
+    py::detail::bind_copy_functions<geometry::TriangleMeshLOD>(lod);
+    lod.def("clear", &geometry::TriangleMeshLOD::Clear,
+            "Removes all levels and tiles.")
+            .def("is_empty", &geometry::TriangleMeshLOD::IsEmpty,
+                 "Returns ``True`` if the hierarchy has no level.")
+            .def("num_levels", &geometry::TriangleMeshLOD::NumLevels,
+                 "Returns the number of levels.")
+            .def("num_tiles", &geometry::TriangleMeshLOD::NumTiles,
+                 "Returns the number of tiles of every level.")
+            .def("get_level", &geometry::TriangleMeshLOD::GetLevel,
+                 "Returns the tiles of the level merged into one mesh.",
+                 "level"_a)
+            .def("get_tile_bound", &geometry::TriangleMeshLOD::GetTileBound,
+                 "Returns the cell of the tile.", "tile"_a)
+            .def_static("create_from_triangle_mesh",
+                        &geometry::TriangleMeshLOD::CreateFromTriangleMesh,
+                        "Builds the level of detail hierarchy of the mesh, "
+                        "every level being simplified from the previous "
+                        "one.",
+                        "mesh"_a, "number_of_levels"_a, "reduction"_a = 0.25,
+                        "tile_depth"_a = 0)
+            .def_readwrite("origin", &geometry::TriangleMeshLOD::origin_,
+                           "Minimum corner of the bounding cube of the "
+                           "tiles.")
+            .def_readwrite("tile_size", &geometry::TriangleMeshLOD::tile_size_,
+                           "Edge length of a tile.")
+            .def_readwrite("tile_depth",
+                           &geometry::TriangleMeshLOD::tile_depth_,
+                           "The cube is split into 2^tile_depth cells per "
+                           "axis.")
+            .def_readwrite("tile_indices",
+                           &geometry::TriangleMeshLOD::tile_indices_,
+                           "Cell of every tile.")
+            .def_readwrite("levels", &geometry::TriangleMeshLOD::levels_,
+                           "``levels[l][t]`` is tile t of level l.")
+            .def("__repr__", [](const geometry::TriangleMeshLOD &lod) {
+                return std::string("geometry::TriangleMeshLOD with ") +
+                       std::to_string(lod.NumLevels()) + " levels and " +
+                       std::to_string(lod.NumTiles()) + " tiles.";
+            });
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "clear");
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "is_empty");
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "num_levels");
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "num_tiles");
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "get_level",
+                                    {{"level", "Index of the level."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshLOD", "get_tile_bound",
+                                    {{"tile", "Index of the tile."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshLOD", "create_from_triangle_mesh",
+            {{"mesh", "The full resolution mesh."},
+             {"number_of_levels",
+              "Number of levels, including the input mesh."},
+             {"reduction",
+              "Ratio of the number of triangles of a level to the number of "
+              "triangles of the previous level, in (0, 1)."},
+             {"tile_depth",
+              "The bounding cube of the mesh is split into 2^tile_depth "
+              "cells per axis. 0 gives a single tile."}});
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
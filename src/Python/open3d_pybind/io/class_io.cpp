@@ -37,6 +37,7 @@
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshLODIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
 #include "open3d_pybind/docstring.h"
@@ -79,6 +80,9 @@ static const std::unordered_map<std::string, std::string>
                 {"config", "AzureKinectSensor's config file."},
                 {"pointcloud", "The ``PointCloud`` object for I/O"},
                 {"mesh", "The ``TriangleMesh`` object for I/O"},
+                {"lod", "The ``TriangleMeshLOD`` object for I/O"},
+                {"level", "Index of the level."},
+                {"tile", "Index of the tile."},
                 {"line_set", "The ``LineSet`` object for I/O"},
                 {"image", "The ``Image`` object for I/O"},
                 {"voxel_grid", "The ``VoxelGrid`` object for I/O"},
@@ -198,6 +202,39 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_triangle_mesh",
                                  map_shared_argument_docstrings);
 
+    // open3d::geometry::TriangleMeshLOD
+    m_io.def("read_triangle_mesh_lod",
+             [](const std::string &filename) {
+                 geometry::TriangleMeshLOD lod;
+                 io::ReadTriangleMeshLOD(filename, lod);
+                 return lod;
+             },
+             "Function to read TriangleMeshLOD from file", "filename"_a);
+    docstring::FunctionDocInject(m_io, "read_triangle_mesh_lod",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_triangle_mesh_lod",
+             [](const std::string &filename,
+                const geometry::TriangleMeshLOD &lod) {
+                 return io::WriteTriangleMeshLOD(filename, lod);
+             },
+             "Function to write TriangleMeshLOD to file", "filename"_a,
+             "lod"_a);
+    docstring::FunctionDocInject(m_io, "write_triangle_mesh_lod",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("read_triangle_mesh_lod_tile",
+             [](const std::string &filename, size_t level, size_t tile) {
+                 geometry::TriangleMesh mesh;
+                 io::ReadTriangleMeshLODTile(filename, level, tile, mesh);
+                 return mesh;
+             },
+             "Function to read a single tile of a single level of a "
+             "TriangleMeshLOD file",
+             "filename"_a, "level"_a, "tile"_a);
+    docstring::FunctionDocInject(m_io, "read_triangle_mesh_lod_tile",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::VoxelGrid
     m_io.def("read_voxel_grid",
              [](const std::string &filename, const std::string &format,
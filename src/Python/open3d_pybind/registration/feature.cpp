@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 #include "open3d_pybind/docstring.h"
@@ -63,11 +64,27 @@ void pybind_feature(py::module &m) {
 }
 
 void pybind_feature_methods(py::module &m) {
-    m.def("compute_fpfh_feature", &registration::ComputeFPFHFeature,
+    m.def("compute_fpfh_feature",
+          static_cast<std::shared_ptr<registration::Feature> (*)(
+                  const geometry::PointCloud &,
+                  const geometry::KDTreeSearchParam &)>(
+                  &registration::ComputeFPFHFeature),
           "Function to compute FPFH feature for a point cloud", "input"_a,
           "search_param"_a);
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+    m.def("compute_fpfh_feature_with_neighborhood",
+          static_cast<std::shared_ptr<registration::Feature> (*)(
+                  const geometry::PointCloud &,
+                  const geometry::NeighborhoodGraph &)>(
+                  &registration::ComputeFPFHFeature),
+          "Function to compute FPFH feature for a point cloud from "
+          "precomputed neighborhoods",
+          "input"_a, "neighborhood"_a);
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature_with_neighborhood",
+            {{"input", "The Input point cloud."},
+             {"neighborhood", "Neighborhoods of all points of input."}});
 }
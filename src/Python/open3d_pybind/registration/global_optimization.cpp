@@ -362,6 +362,71 @@ void pybind_global_optimization(py::module &m) {
                             std::string("\n> reference_node : ") +
                             std::to_string(goo.reference_node_);
                  });
+
+    py::class_<registration::IncrementalGlobalOptimization> incremental(
+            m, "IncrementalGlobalOptimization",
+            "Pose graph optimizer for graphs that grow over time. Each update "
+            "re-optimizes only the nodes from the oldest node touched by a new "
+            "edge up to the newest node, holding the older nodes fixed.");
+    py::detail::bind_copy_functions<
+            registration::IncrementalGlobalOptimization>(incremental);
+    incremental
+            .def(py::init([](const registration::
+                                     GlobalOptimizationConvergenceCriteria
+                                             &criteria,
+                             const registration::GlobalOptimizationOption
+                                     &option,
+                             int full_optimization_interval) {
+                     return new registration::IncrementalGlobalOptimization(
+                             criteria, option, full_optimization_interval);
+                 }),
+                 "criteria"_a =
+                         registration::GlobalOptimizationConvergenceCriteria(),
+                 "option"_a = registration::GlobalOptimizationOption(),
+                 "full_optimization_interval"_a = 0)
+            .def("add_node",
+                 &registration::IncrementalGlobalOptimization::AddNode,
+                 "Appends a node and returns its index.", "node"_a)
+            .def("add_edge",
+                 &registration::IncrementalGlobalOptimization::AddEdge,
+                 "Appends an edge between two existing nodes.", "edge"_a)
+            .def("update", &registration::IncrementalGlobalOptimization::Update,
+                 "Optimizes the part of the graph affected by the nodes and "
+                 "edges added since the last update, or the full graph if it "
+                 "is due.")
+            .def("optimize_full",
+                 &registration::IncrementalGlobalOptimization::OptimizeFull,
+                 "Optimizes the full graph with global_optimization.")
+            .def("get_pose_graph",
+                 &registration::IncrementalGlobalOptimization::GetPoseGraph,
+                 "Returns the current pose graph.")
+            .def("get_number_of_affected_nodes",
+                 &registration::IncrementalGlobalOptimization::
+                         GetNumberOfAffectedNodes,
+                 "Returns the number of nodes optimized by the last update.")
+            .def_readwrite("criteria",
+                           &registration::IncrementalGlobalOptimization::
+                                   criteria_,
+                           "GlobalOptimizationConvergenceCriteria: "
+                           "Convergence criteria of each update.")
+            .def_readwrite(
+                    "option",
+                    &registration::IncrementalGlobalOptimization::option_,
+                    "GlobalOptimizationOption: Global optimization options.")
+            .def_readwrite("full_optimization_interval",
+                           &registration::IncrementalGlobalOptimization::
+                                   full_optimization_interval_,
+                           "int: Number of updates between two full "
+                           "optimizations, 0 for never.")
+            .def("__repr__",
+                 [](const registration::IncrementalGlobalOptimization &igo) {
+                     return std::string(
+                                    "IncrementalGlobalOptimization with ") +
+                            std::to_string(igo.GetPoseGraph().nodes_.size()) +
+                            std::string(" nodes and ") +
+                            std::to_string(igo.GetPoseGraph().edges_.size()) +
+                            std::string(" edges.");
+                 });
 }
 
 void pybind_global_optimization_methods(py::module &m) {
@@ -25,11 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Registration.h"
+#include "Open3D/Geometry/NeighborhoodGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/ColoredICP.h"
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FragmentRegistration.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -130,11 +134,13 @@ void pybind_registration_classes(py::module &m) {
     py::detail::bind_copy_functions<registration::RANSACConvergenceCriteria>(
             ransac_criteria);
     ransac_criteria
-            .def(py::init([](int max_iteration, int max_validation) {
+            .def(py::init([](int max_iteration, int max_validation,
+                             int seed) {
                      return new registration::RANSACConvergenceCriteria(
-                             max_iteration, max_validation);
+                             max_iteration, max_validation, seed);
                  }),
-                 "max_iteration"_a = 1000, "max_validation"_a = 1000)
+                 "max_iteration"_a = 1000, "max_validation"_a = 1000,
+                 "seed"_a = -1)
             .def_readwrite(
                     "max_iteration",
                     &registration::RANSACConvergenceCriteria::max_iteration_,
@@ -144,15 +150,136 @@ void pybind_registration_classes(py::module &m) {
                     &registration::RANSACConvergenceCriteria::max_validation_,
                     "Maximum times the validation has been run before the "
                     "iteration stops.")
+            .def_readwrite("seed",
+                           &registration::RANSACConvergenceCriteria::seed_,
+                           "Seed of the random sampling. A non-negative seed "
+                           "gives reproducible results for any number of "
+                           "threads, a negative seed draws a new seed for "
+                           "every run.")
             .def("__repr__",
                  [](const registration::RANSACConvergenceCriteria &c) {
                      return fmt::format(
                              "registration::RANSACConvergenceCriteria "
                              "class with max_iteration={:d}, "
-                             "and max_validation={:d}",
-                             c.max_iteration_, c.max_validation_);
+                             "max_validation={:d}, and seed={:d}",
+                             c.max_iteration_, c.max_validation_, c.seed_);
                  });
 
+    // open3d.registration.RobustKernel
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>>
+            rk(m, "RobustKernel",
+               "Base class of the robust loss functions used to down-weight "
+               "outlier correspondences in iteratively reweighted least "
+               "squares.");
+    rk.def("weight", &registration::RobustKernel::Weight, "residual"_a,
+           "Returns the IRLS weight of the residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               registration::RobustKernel>
+            l2_loss(m, "L2Loss",
+                    "Plain least squares, every residual has weight 1.");
+    py::detail::bind_default_constructor<registration::L2Loss>(l2_loss);
+    l2_loss.def("__repr__", [](const registration::L2Loss &rk) {
+        return std::string("registration::L2Loss");
+    });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss,
+               std::shared_ptr<registration::HuberLoss>,
+               registration::RobustKernel>
+            huber_loss(m, "HuberLoss",
+                       "Huber loss, quadratic for ``|r| <= k``, linear "
+                       "beyond.");
+    huber_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::HuberLoss::k_,
+                           "Threshold between the quadratic and the linear "
+                           "region.")
+            .def("__repr__", [](const registration::HuberLoss &rk) {
+                return fmt::format("registration::HuberLoss with k={:f}",
+                                   rk.k_);
+            });
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss,
+               std::shared_ptr<registration::TukeyLoss>,
+               registration::RobustKernel>
+            tukey_loss(m, "TukeyLoss",
+                       "Tukey biweight loss, residuals with ``|r| > k`` have "
+                       "weight 0.");
+    tukey_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::TukeyLoss::k_,
+                           "Residuals larger than ``k`` are rejected.")
+            .def("__repr__", [](const registration::TukeyLoss &rk) {
+                return fmt::format("registration::TukeyLoss with k={:f}",
+                                   rk.k_);
+            });
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss,
+               std::shared_ptr<registration::CauchyLoss>,
+               registration::RobustKernel>
+            cauchy_loss(m, "CauchyLoss", "Cauchy (Lorentzian) loss.");
+    cauchy_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::CauchyLoss::k_,
+                           "Scale parameter of the kernel.")
+            .def("__repr__", [](const registration::CauchyLoss &rk) {
+                return fmt::format("registration::CauchyLoss with k={:f}",
+                                   rk.k_);
+            });
+
+    // open3d.registration.GMLoss: RobustKernel
+    py::class_<registration::GMLoss, std::shared_ptr<registration::GMLoss>,
+               registration::RobustKernel>
+            gm_loss(m, "GMLoss", "Geman-McClure loss.");
+    gm_loss.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::GMLoss::k_,
+                           "Scale parameter of the kernel.")
+            .def("__repr__", [](const registration::GMLoss &rk) {
+                return fmt::format("registration::GMLoss with k={:f}", rk.k_);
+            });
+
+    // open3d.registration.IRLSOption
+    py::class_<registration::IRLSOption> irls_option(
+            m, "IRLSOption",
+            "Options of the iteratively reweighted least squares solver used "
+            "by robust transformation estimation. With graduated "
+            "non-convexity the kernel starts ``gnc_initial_scale`` times "
+            "wider and is narrowed by ``gnc_division_factor`` every step.");
+    py::detail::bind_copy_functions<registration::IRLSOption>(irls_option);
+    irls_option
+            .def(py::init([](int max_iteration, double gnc_initial_scale,
+                             double gnc_division_factor, double min_update) {
+                     return new registration::IRLSOption(
+                             max_iteration, gnc_initial_scale,
+                             gnc_division_factor, min_update);
+                 }),
+                 "max_iteration"_a = 1, "gnc_initial_scale"_a = 1.0,
+                 "gnc_division_factor"_a = 1.4, "min_update"_a = 1e-6)
+            .def_readwrite("max_iteration",
+                           &registration::IRLSOption::max_iteration_,
+                           "Maximum number of reweighted steps per call.")
+            .def_readwrite("gnc_initial_scale",
+                           &registration::IRLSOption::gnc_initial_scale_,
+                           "Initial kernel scale for graduated "
+                           "non-convexity, 1 disables GNC.")
+            .def_readwrite("gnc_division_factor",
+                           &registration::IRLSOption::gnc_division_factor_,
+                           "Factor the kernel scale is divided by after "
+                           "every step.")
+            .def_readwrite("min_update", &registration::IRLSOption::min_update_,
+                           "Convergence threshold on the norm of the 6D "
+                           "update.")
+            .def("__repr__", [](const registration::IRLSOption &c) {
+                return fmt::format(
+                        "registration::IRLSOption class with "
+                        "max_iteration={:d}, gnc_initial_scale={:f}, "
+                        "gnc_division_factor={:f}, and min_update={:e}",
+                        c.max_iteration_, c.gnc_initial_scale_,
+                        c.gnc_division_factor_, c.min_update_);
+            });
+
     // open3d.registration.TransformationEstimation
     py::class_<
             registration::TransformationEstimation,
@@ -236,11 +363,27 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel,
+                           const registration::IRLSOption &irls_option) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(kernel,
+                                                                irls_option);
+               }),
+               "kernel"_a, "irls_option"_a = registration::IRLSOption())
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string("TransformationEstimationPointToPlane");
+                 })
+            .def_readwrite("kernel",
+                           &registration::TransformationEstimationPointToPlane::
+                                   kernel_,
+                           "Robust kernel used to weight the "
+                           "correspondences.")
+            .def_readwrite("irls_option",
+                           &registration::TransformationEstimationPointToPlane::
+                                   irls_option_,
+                           "Options of the IRLS solver.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -385,17 +528,26 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             bool use_approximate_matching,
+                             int approximate_matching_trees,
+                             int approximate_matching_checks) {
                      return new registration::FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             use_approximate_matching,
+                             approximate_matching_trees,
+                             approximate_matching_checks);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "use_approximate_matching"_a = false,
+                 "approximate_matching_trees"_a = 4,
+                 "approximate_matching_checks"_a = 128)
             .def_readwrite(
                     "division_factor",
                     &registration::FastGlobalRegistrationOption::
@@ -429,6 +581,22 @@ must hold true for all edges.)");
                            &registration::FastGlobalRegistrationOption::
                                    maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("use_approximate_matching",
+                           &registration::FastGlobalRegistrationOption::
+                                   use_approximate_matching_,
+                           "bool: Set to ``True`` to match features with a "
+                           "randomized k-d forest instead of an exact k-d "
+                           "tree.")
+            .def_readwrite("approximate_matching_trees",
+                           &registration::FastGlobalRegistrationOption::
+                                   approximate_matching_trees_,
+                           "int: Number of randomized k-d trees used for "
+                           "approximate matching.")
+            .def_readwrite("approximate_matching_checks",
+                           &registration::FastGlobalRegistrationOption::
+                                   approximate_matching_checks_,
+                           "int: Number of leaves visited per query in "
+                           "approximate matching. Higher is more accurate.")
             .def("__repr__",
                  [](const registration::FastGlobalRegistrationOption &c) {
                      return fmt::format(
@@ -440,11 +608,113 @@ must hold true for all edges.)");
                              "\nmaximum_correspondence_distance={}"
                              "\niteration_number={}"
                              "\ntuple_scale={}"
-                             "\nmaximum_tuple_count={}",
+                             "\nmaximum_tuple_count={}"
+                             "\nuse_approximate_matching={}"
+                             "\napproximate_matching_trees={}"
+                             "\napproximate_matching_checks={}",
                              c.division_factor_, c.use_absolute_scale_,
                              c.decrease_mu_, c.maximum_correspondence_distance_,
                              c.iteration_number_, c.tuple_scale_,
-                             c.maximum_tuple_count_);
+                             c.maximum_tuple_count_,
+                             c.use_approximate_matching_,
+                             c.approximate_matching_trees_,
+                             c.approximate_matching_checks_);
+                 });
+
+    // open3d.registration.FragmentPair
+    py::class_<registration::FragmentPair> fragment_pair(
+            m, "FragmentPair",
+            "A candidate pair of fragments for ``register_fragments``. A pair "
+            "with an initial transformation is refined with ICP (odometry), "
+            "a pair without one is registered globally (loop closure).");
+    py::detail::bind_copy_functions<registration::FragmentPair>(fragment_pair);
+    fragment_pair
+            .def(py::init([](int source_id, int target_id) {
+                     return new registration::FragmentPair(source_id,
+                                                           target_id);
+                 }),
+                 "source_id"_a, "target_id"_a)
+            .def(py::init([](int source_id, int target_id,
+                             const Eigen::Matrix4d &initial_transformation) {
+                     return new registration::FragmentPair(
+                             source_id, target_id, initial_transformation);
+                 }),
+                 "source_id"_a, "target_id"_a, "initial_transformation"_a)
+            .def_readwrite("source_id",
+                           &registration::FragmentPair::source_id_,
+                           "int: Index of the source fragment.")
+            .def_readwrite("target_id",
+                           &registration::FragmentPair::target_id_,
+                           "int: Index of the target fragment.")
+            .def_readwrite("has_initial_transformation",
+                           &registration::FragmentPair::
+                                   has_initial_transformation_,
+                           "bool: Whether ``initial_transformation`` is "
+                           "valid.")
+            .def_readwrite(
+                    "initial_transformation",
+                    &registration::FragmentPair::initial_transformation_,
+                    "``4 x 4`` float64 numpy array: Initial transformation "
+                    "from source to target.")
+            .def("__repr__", [](const registration::FragmentPair &c) {
+                return fmt::format(
+                        "registration::FragmentPair ({:d}, {:d}) {}",
+                        c.source_id_, c.target_id_,
+                        c.has_initial_transformation_ ? "odometry"
+                                                      : "loop closure");
+            });
+
+    // open3d.registration.FragmentRegistrationOption
+    py::class_<registration::FragmentRegistrationOption> fragment_option(
+            m, "FragmentRegistrationOption",
+            "Options for ``register_fragments``.");
+    py::detail::bind_copy_functions<registration::FragmentRegistrationOption>(
+            fragment_option);
+    fragment_option
+            .def(py::init([](double voxel_size,
+                             bool use_fast_global_registration,
+                             double minimum_information_ratio) {
+                     return new registration::FragmentRegistrationOption(
+                             voxel_size, use_fast_global_registration,
+                             minimum_information_ratio);
+                 }),
+                 "voxel_size"_a = 0.05,
+                 "use_fast_global_registration"_a = true,
+                 "minimum_information_ratio"_a = 0.3)
+            .def_readwrite(
+                    "voxel_size",
+                    &registration::FragmentRegistrationOption::voxel_size_,
+                    "float: Voxel size used to downsample the fragments.")
+            .def_readwrite("use_fast_global_registration",
+                           &registration::FragmentRegistrationOption::
+                                   use_fast_global_registration_,
+                           "bool: Use fast global registration for loop "
+                           "closure pairs, RANSAC otherwise.")
+            .def_readwrite("minimum_information_ratio",
+                           &registration::FragmentRegistrationOption::
+                                   minimum_information_ratio_,
+                           "float: Loop closure pairs with information(5, 5) "
+                           "/ min(#source points, #target points) below this "
+                           "ratio are rejected.")
+            .def_readwrite(
+                    "ransac_criteria",
+                    &registration::FragmentRegistrationOption::ransac_criteria_,
+                    "RANSACConvergenceCriteria: Convergence criteria of "
+                    "RANSAC.")
+            .def_readwrite(
+                    "icp_criteria",
+                    &registration::FragmentRegistrationOption::icp_criteria_,
+                    "ICPConvergenceCriteria: Convergence criteria of ICP for "
+                    "odometry pairs.")
+            .def("__repr__",
+                 [](const registration::FragmentRegistrationOption &c) {
+                     return fmt::format(
+                             "registration::FragmentRegistrationOption class "
+                             "with \nvoxel_size={}"
+                             "\nuse_fast_global_registration={}"
+                             "\nminimum_information_ratio={}",
+                             c.voxel_size_, c.use_fast_global_registration_,
+                             c.minimum_information_ratio_);
                  });
 
     // open3d.registration.RegistrationResult
@@ -502,6 +772,12 @@ static const std::unordered_map<std::string, std::string>
                  "(``registration::TransformationEstimationPointToPoint``, "
                  "``registration::TransformationEstimationPointToPlane``)"},
                 {"init", "Initial transformation estimation"},
+                {"irls_option",
+                 "Options of the iteratively reweighted least squares "
+                 "solver"},
+                {"kernel",
+                 "Robust kernel applied to the residuals. ``None`` for least "
+                 "squares"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
@@ -511,6 +787,8 @@ static const std::unordered_map<std::string, std::string>
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
                 {"target", "The target point cloud."},
+                {"target_neighborhood",
+                 "Neighborhoods of all points of the target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
                  "``target``"}};
@@ -523,7 +801,13 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &registration::RegistrationICP,
+    m.def("registration_icp",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const registration::ICPConvergenceCriteria &)>(
+                  &registration::RegistrationICP),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -533,15 +817,44 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_colored_icp", &registration::RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double,
+                  std::shared_ptr<registration::RobustKernel>,
+                  const registration::IRLSOption &)>(
+                  &registration::RegistrationColoredICP),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "criteria"_a = registration::ICPConvergenceCriteria(),
-          "lambda_geometric"_a = 0.968);
+          "lambda_geometric"_a = 0.968, "kernel"_a = nullptr,
+          "irls_option"_a = registration::IRLSOption());
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_colored_icp_with_neighborhood",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const geometry::NeighborhoodGraph &, double,
+                  const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double,
+                  std::shared_ptr<registration::RobustKernel>,
+                  const registration::IRLSOption &)>(
+                  &registration::RegistrationColoredICP),
+          "Function for Colored ICP registration with precomputed target "
+          "neighborhoods",
+          "source"_a, "target"_a, "target_neighborhood"_a,
+          "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          "lambda_geometric"_a = 0.968, "kernel"_a = nullptr,
+          "irls_option"_a = registration::IRLSOption());
+    docstring::FunctionDocInject(m,
+                                 "registration_colored_icp_with_neighborhood",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
           "Function for global RANSAC registration based on a set of "
@@ -580,13 +893,27 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("get_information_matrix_from_point_clouds",
-          &registration::GetInformationMatrixFromPointClouds,
+          static_cast<Eigen::Matrix6d (*)(const geometry::PointCloud &,
+                                          const geometry::PointCloud &, double,
+                                          const Eigen::Matrix4d &)>(
+                  &registration::GetInformationMatrixFromPointClouds),
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a);
     docstring::FunctionDocInject(m, "get_information_matrix_from_point_clouds",
                                  map_shared_argument_docstrings);
+
+    m.def("register_fragments", &registration::RegisterFragments,
+          "Function for registering many fragment pairs in parallel and "
+          "building a pose graph from the results",
+          "fragments"_a, "pairs"_a,
+          "option"_a = registration::FragmentRegistrationOption());
+    docstring::FunctionDocInject(
+            m, "register_fragments",
+            {{"fragments", "List of fragment point clouds."},
+             {"pairs", "List of ``registration::FragmentPair``."},
+             {"option", "Registration option"}});
 }
 
 void pybind_registration(py::module &m) {
@@ -67,10 +67,8 @@ int main(int argc, char **argv) {
     }
 
     if (utility::ProgramOptionExists(argc, argv, "--purge")) {
-        merged_mesh_ptr->RemoveDuplicatedVertices();
-        merged_mesh_ptr->RemoveDuplicatedTriangles();
-        merged_mesh_ptr->RemoveUnreferencedVertices();
-        merged_mesh_ptr->RemoveDegenerateTriangles();
+        merged_mesh_ptr->CleanMesh(true, false, true, true)
+                .RemoveDegenerateTriangles();
     }
     io::WriteTriangleMesh(argv[2], *merged_mesh_ptr);
 
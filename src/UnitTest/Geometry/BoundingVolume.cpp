@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(AxisAlignedBoundingBox, GetPointIndicesWithinBoundingBox) {
+    vector<Vector3d> points(10000);
+    Rand(points, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 0);
+    geometry::AxisAlignedBoundingBox box(Vector3d(-0.5, -0.2, 0.0),
+                                         Vector3d(0.3, 0.6, 0.9));
+
+    vector<size_t> ref;
+    for (size_t i = 0; i < points.size(); i++) {
+        if ((points[i].array() >= box.min_bound_.array()).all() &&
+            (points[i].array() <= box.max_bound_.array()).all()) {
+            ref.push_back(i);
+        }
+    }
+    EXPECT_FALSE(ref.empty());
+    EXPECT_EQ(ref, box.GetPointIndicesWithinBoundingBox(points));
+}
+
+TEST(AxisAlignedBoundingBox, CreateFromPoints) {
+    vector<Vector3d> points(10000);
+    Rand(points, Vector3d(-1.0, -2.0, -3.0), Vector3d(1.0, 2.0, 3.0), 0);
+    points[4321] = Vector3d(5.0, -6.0, 7.0);
+
+    auto box = geometry::AxisAlignedBoundingBox::CreateFromPoints(points);
+    Vector3d min_bound = points[0];
+    Vector3d max_bound = points[0];
+    for (const auto& point : points) {
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    ExpectEQ(min_bound, box.min_bound_);
+    ExpectEQ(max_bound, box.max_bound_);
+}
+
+TEST(OrientedBoundingBox, GetPointIndicesWithinBoundingBox) {
+    Matrix3d R = AngleAxisd(0.7, Vector3d(1.0, 2.0, 3.0).normalized())
+                         .toRotationMatrix();
+    geometry::OrientedBoundingBox box(Vector3d(1.0, -2.0, 0.5), R,
+                                      Vector3d(2.0, 1.0, 0.5));
+
+    // Points inside and outside the box, generated in the frame of the box.
+    vector<Vector3d> local(2000);
+    Rand(local, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 0);
+    vector<Vector3d> points;
+    vector<size_t> ref;
+    for (size_t i = 0; i < local.size(); i++) {
+        Vector3d offset = local[i].cwiseProduct(box.extent_) / 2;
+        if (i % 2 == 0) {
+            offset *= 0.99;
+            ref.push_back(i);
+        } else {
+            int axis = (int)(i / 2) % 3;
+            offset(axis) = (offset(axis) < 0 ? -0.51 : 0.51) *
+                           box.extent_(axis);
+        }
+        points.push_back(box.center_ + R * offset);
+    }
+    EXPECT_EQ(ref, box.GetPointIndicesWithinBoundingBox(points));
+}
+
+TEST(OrientedBoundingBox, CreateFromPointsWithoutConvexHull) {
+    Matrix3d R = AngleAxisd(0.4, Vector3d(0.0, 1.0, 1.0).normalized())
+                         .toRotationMatrix();
+    Vector3d center(3.0, 2.0, 1.0);
+    vector<Vector3d> points(20000);
+    Rand(points, Vector3d(-4.0, -2.0, -1.0), Vector3d(4.0, 2.0, 1.0), 0);
+    for (auto& point : points) {
+        point = center + R * point;
+    }
+
+    auto box = geometry::OrientedBoundingBox::CreateFromPoints(points, false);
+    // Points on the faces may fall outside by a rounding error.
+    geometry::OrientedBoundingBox padded = box;
+    padded.Scale(1.0 + 1e-9, true);
+    EXPECT_EQ(points.size(),
+              padded.GetPointIndicesWithinBoundingBox(points).size());
+    EXPECT_NEAR(8.0 * 4.0 * 2.0, box.Volume(), 1.0);
+    // The longest axis is found first.
+    EXPECT_NEAR(1.0, std::abs(box.R_.col(0).dot(R.col(0))), 1e-3);
+    EXPECT_NEAR(8.0, box.extent_(0), 0.1);
+    EXPECT_TRUE(box.center_.isApprox(center, 1e-2));
+
+    auto empty = geometry::OrientedBoundingBox::CreateFromPoints({}, false);
+    EXPECT_TRUE(empty.IsEmpty());
+}
@@ -87,3 +87,67 @@ TEST(IntersectionTest, LineSegmentsMinimumDistance) {
                                                                       q0, q1),
               1.);
 }
+
+TEST(IntersectionTest, RayTriangle) {
+    Eigen::Vector3d v0(0, 0, 0);
+    Eigen::Vector3d v1(1, 0, 0);
+    Eigen::Vector3d v2(0, 1, 0);
+    EXPECT_NEAR(geometry::IntersectionTest::RayTriangle(
+                        Eigen::Vector3d(0.2, 0.2, 2), Eigen::Vector3d(0, 0, -1),
+                        v0, v1, v2),
+                2., THRESHOLD_1E_6);
+    // Non-normalized direction.
+    EXPECT_NEAR(geometry::IntersectionTest::RayTriangle(
+                        Eigen::Vector3d(0.2, 0.2, 2), Eigen::Vector3d(0, 0, -4),
+                        v0, v1, v2),
+                0.5, THRESHOLD_1E_6);
+    // Pointing away, outside, and parallel to the triangle.
+    EXPECT_LT(geometry::IntersectionTest::RayTriangle(
+                      Eigen::Vector3d(0.2, 0.2, 2), Eigen::Vector3d(0, 0, 1),
+                      v0, v1, v2),
+              0.);
+    EXPECT_LT(geometry::IntersectionTest::RayTriangle(
+                      Eigen::Vector3d(0.8, 0.8, 2), Eigen::Vector3d(0, 0, -1),
+                      v0, v1, v2),
+              0.);
+    EXPECT_LT(geometry::IntersectionTest::RayTriangle(
+                      Eigen::Vector3d(0.2, 0.2, 2), Eigen::Vector3d(1, 0, 0),
+                      v0, v1, v2),
+              0.);
+}
+
+TEST(IntersectionTest, PointTriangleClosestPoint) {
+    Eigen::Vector3d v0(0, 0, 0);
+    Eigen::Vector3d v1(2, 0, 0);
+    Eigen::Vector3d v2(0, 2, 0);
+    auto Closest = [&](const Eigen::Vector3d& point) {
+        return geometry::IntersectionTest::PointTriangleClosestPoint(point, v0,
+                                                                     v1, v2);
+    };
+    // Face, vertex and edge regions.
+    ExpectEQ(Closest(Eigen::Vector3d(0.5, 0.5, 3)),
+             Eigen::Vector3d(0.5, 0.5, 0));
+    ExpectEQ(Closest(Eigen::Vector3d(-1, -1, 1)), v0);
+    ExpectEQ(Closest(Eigen::Vector3d(3, -1, 0)), v1);
+    ExpectEQ(Closest(Eigen::Vector3d(-1, 3, 0)), v2);
+    ExpectEQ(Closest(Eigen::Vector3d(1, -1, 1)), Eigen::Vector3d(1, 0, 0));
+    ExpectEQ(Closest(Eigen::Vector3d(-1, 1, 1)), Eigen::Vector3d(0, 1, 0));
+    ExpectEQ(Closest(Eigen::Vector3d(2, 2, -1)), Eigen::Vector3d(1, 1, 0));
+}
+
+TEST(IntersectionTest, PointTriangleClosestPointBarycentric) {
+    Eigen::Vector3d v0(0, 0, 0);
+    Eigen::Vector3d v1(2, 0, 0);
+    Eigen::Vector3d v2(0, 2, 0);
+    auto Barycentric = [&](const Eigen::Vector3d& point) {
+        return geometry::IntersectionTest::PointTriangleClosestPointBarycentric(
+                point, v0, v1, v2);
+    };
+    ExpectEQ(Barycentric(Eigen::Vector3d(0.5, 0.5, 3)),
+             Eigen::Vector3d(0.5, 0.25, 0.25));
+    ExpectEQ(Barycentric(Eigen::Vector3d(3, -1, 0)), Eigen::Vector3d(0, 1, 0));
+    ExpectEQ(Barycentric(Eigen::Vector3d(1, -1, 1)),
+             Eigen::Vector3d(0.5, 0.5, 0));
+    ExpectEQ(Barycentric(Eigen::Vector3d(2, 2, -1)),
+             Eigen::Vector3d(0, 0.5, 0.5));
+}
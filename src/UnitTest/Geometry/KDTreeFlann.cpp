@@ -144,3 +144,32 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_indices, indices);
     ExpectEQ(ref_distance2, distance2);
 }
+
+TEST(KDTreeFlann, CountRadius) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+
+    Vector3d query = {1.647059, 4.392157, 8.784314};
+    double radius = 5.0;
+
+    EXPECT_EQ(kdtree.CountRadius<Vector3d>(query, radius), 21);
+    EXPECT_EQ(kdtree.CountRadius<Vector3d>(query, radius, 100), 21);
+    EXPECT_EQ(kdtree.CountRadius<Vector3d>(query, radius, 5), 5);
+
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        int k = kdtree.SearchRadius<Vector3d>(pc.points_[i], 2.5, indices,
+                                              distance2);
+        EXPECT_EQ(kdtree.CountRadius<Vector3d>(pc.points_[i], 2.5), k);
+    }
+}
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+
+#include "Open3D/Geometry/NeighborhoodGraph.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+void ExpectGraphMatchesSearch(const geometry::PointCloud &pc,
+                              const geometry::KDTreeSearchParam &param) {
+    geometry::NeighborhoodGraph graph(pc, param);
+    geometry::KDTreeFlann kdtree(pc);
+
+    EXPECT_EQ(graph.NumPoints(), pc.points_.size());
+    EXPECT_EQ(graph.offsets_.back(), graph.indices_.size());
+    EXPECT_EQ(graph.indices_.size(), graph.distance2_.size());
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        int k = kdtree.Search(pc.points_[i], param, indices, distance2);
+        EXPECT_EQ(graph.NumNeighbors(i), k);
+        ExpectEQ(indices, vector<int>(graph.NeighborIndices(i),
+                                      graph.NeighborIndices(i) + k));
+        ExpectEQ(distance2, vector<double>(graph.NeighborDistance2(i),
+                                           graph.NeighborDistance2(i) + k));
+    }
+}
+
+/// Hybrid search by a linear scan: the \p max_nn nearest points within
+/// \p radius, sorted by distance.
+vector<int> BruteForceHybridSearch(const geometry::PointCloud &pc,
+                                   const Vector3d &query,
+                                   double radius,
+                                   int max_nn) {
+    vector<pair<double, int>> candidates;
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        double distance2 = (pc.points_[i] - query).squaredNorm();
+        if (distance2 <= radius * radius) {
+            candidates.push_back(make_pair(distance2, int(i)));
+        }
+    }
+    sort(candidates.begin(), candidates.end());
+    vector<int> indices;
+    for (size_t k = 0; k < candidates.size() && int(k) < max_nn; k++) {
+        indices.push_back(candidates[k].second);
+    }
+    return indices;
+}
+
+/// Angle, cosine and distance features of a point pair as in Rusu et al.,
+/// "Fast Point Feature Histograms (FPFH) for 3D Registration".
+Vector3d PairFeatures(const Vector3d &p1,
+                      const Vector3d &n1,
+                      const Vector3d &p2,
+                      const Vector3d &n2) {
+    Vector3d dp = p2 - p1;
+    double distance = dp.norm();
+    Vector3d u = n1;
+    Vector3d n = n2;
+    double phi = n1.dot(dp) / distance;
+    double phi2 = n2.dot(dp) / distance;
+    if (acos(fabs(phi)) > acos(fabs(phi2))) {
+        u = n2;
+        n = n1;
+        dp = -dp;
+        phi = -phi2;
+    }
+    Vector3d v = dp.cross(u).normalized();
+    Vector3d w = u.cross(v);
+    return Vector3d(atan2(w.dot(n), u.dot(n)), v.dot(n), phi);
+}
+
+/// Simplified point feature histograms of every point, 11 bins per feature.
+MatrixXd BruteForceSPFH(const geometry::PointCloud &pc,
+                        const vector<vector<int>> &neighbors) {
+    MatrixXd spfh = MatrixXd::Zero(33, pc.points_.size());
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        const vector<int> &nbs = neighbors[i];
+        for (size_t k = 1; k < nbs.size(); k++) {
+            Vector3d f = PairFeatures(pc.points_[i], pc.normals_[i],
+                                      pc.points_[nbs[k]], pc.normals_[nbs[k]]);
+            Vector3d bins((f(0) + M_PI) / (2.0 * M_PI), (f(1) + 1.0) * 0.5,
+                          (f(2) + 1.0) * 0.5);
+            for (int j = 0; j < 3; j++) {
+                int bin = min(max(int(floor(11 * bins(j))), 0), 10);
+                spfh(11 * j + bin, i) += 100.0 / double(nbs.size() - 1);
+            }
+        }
+    }
+    return spfh;
+}
+
+}  // unnamed namespace
+
+TEST(NeighborhoodGraph, ComputeNeighborhood) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    ExpectGraphMatchesSearch(pc, geometry::KDTreeSearchParamKNN(10));
+    ExpectGraphMatchesSearch(pc, geometry::KDTreeSearchParamRadius(2.5));
+    ExpectGraphMatchesSearch(pc, geometry::KDTreeSearchParamHybrid(2.5, 5));
+
+    // Rows of a KNN graph are shorter than knn on small clouds.
+    pc.points_.resize(7);
+    geometry::NeighborhoodGraph graph(pc, geometry::KDTreeSearchParamKNN(30));
+    EXPECT_EQ(graph.NumPoints(), 7u);
+    EXPECT_EQ(graph.indices_.size(), 49u);
+    for (size_t i = 0; i < 7; i++) {
+        EXPECT_EQ(graph.NumNeighbors(i), 7);
+        EXPECT_EQ(graph.NeighborIndices(i)[0], int(i));
+    }
+
+    graph.Clear();
+    EXPECT_EQ(graph.NumPoints(), 0u);
+}
+
+TEST(NeighborhoodGraph, EstimateNormals) {
+    int size = 1000;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    // Reference normals and features from linear scan neighborhoods.
+    double radius = 2.0;
+    int max_nn = 20;
+    vector<vector<int>> neighbors(size);
+    for (int i = 0; i < size; i++) {
+        neighbors[i] =
+                BruteForceHybridSearch(pc, pc.points_[i], radius, max_nn);
+    }
+
+    geometry::KDTreeSearchParamHybrid param(radius, max_nn);
+    geometry::NeighborhoodGraph graph(pc, param);
+    pc.EstimateNormals(graph, false);
+    for (int i = 0; i < size; i++) {
+        ASSERT_GE(neighbors[i].size(), 3u);
+        Vector3d mean = Vector3d::Zero();
+        for (int nb : neighbors[i]) {
+            mean += pc.points_[nb];
+        }
+        mean /= double(neighbors[i].size());
+        Matrix3d covariance = Matrix3d::Zero();
+        for (int nb : neighbors[i]) {
+            covariance += (pc.points_[nb] - mean) *
+                          (pc.points_[nb] - mean).transpose();
+        }
+        SelfAdjointEigenSolver<Matrix3d> solver(covariance);
+        EXPECT_NEAR(1.0, fabs(solver.eigenvectors().col(0).dot(pc.normals_[i])),
+                    THRESHOLD_1E_6);
+    }
+
+    MatrixXd spfh = BruteForceSPFH(pc, neighbors);
+    MatrixXd ref = spfh;
+    for (int i = 0; i < size; i++) {
+        const vector<int> &nbs = neighbors[i];
+        MatrixXd weighted = MatrixXd::Zero(33, 1);
+        for (size_t k = 1; k < nbs.size(); k++) {
+            weighted += spfh.col(nbs[k]) /
+                        (pc.points_[nbs[k]] - pc.points_[i]).squaredNorm();
+        }
+        for (int j = 0; j < 3; j++) {
+            weighted.middleRows(11 * j, 11) *=
+                    100.0 / weighted.middleRows(11 * j, 11).sum();
+        }
+        ref.col(i) += weighted;
+    }
+    auto feature = registration::ComputeFPFHFeature(pc, graph);
+    EXPECT_LT((ref - feature->data_).cwiseAbs().maxCoeff(), THRESHOLD_1E_6);
+
+    geometry::PointCloud other;
+    other.points_.resize(10);
+    EXPECT_ANY_THROW(other.EstimateNormals(graph));
+}
@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
 #include <algorithm>
+#include <numeric>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/BoundingVolume.h"
@@ -447,6 +449,28 @@ TEST(PointCloud, SelectByIndex) {
     ExpectEQ(ref, output_pc->points_);
 }
 
+TEST(PointCloud, SelectByIndexInPlace) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    pc.normals_.resize(1000);
+    pc.colors_.resize(1000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pc.normals_, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pc.colors_, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), 2);
+
+    vector<size_t> indices(300);
+    Rand(indices, 0, 999, 0);
+
+    for (bool invert : {false, true}) {
+        auto ref = pc.SelectByIndex(indices, invert);
+        geometry::PointCloud output = pc;
+        output.SelectByIndexInPlace(indices, invert);
+        ExpectEQ(ref->points_, output.points_);
+        ExpectEQ(ref->normals_, output.normals_);
+        ExpectEQ(ref->colors_, output.colors_);
+    }
+}
+
 TEST(PointCloud, VoxelDownSample) {
     vector<Vector3d> ref_points = {{19.607843, 454.901961, 62.745098},
                                    {66.666667, 949.019608, 525.490196},
@@ -588,6 +612,52 @@ TEST(PointCloud, CropPointCloud) {
     ExpectGE(maxBound, output_pc->points_);
 }
 
+TEST(PointCloud, RemoveRadiusOutliers) {
+    geometry::PointCloud pc;
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            pc.points_.push_back(Eigen::Vector3d(x, y, 0) * 0.1);
+        }
+    }
+    pc.points_.push_back(Eigen::Vector3d(5, 5, 5));
+
+    std::shared_ptr<geometry::PointCloud> inliers;
+    std::vector<size_t> indices;
+    std::tie(inliers, indices) = pc.RemoveRadiusOutliers(3, 0.15);
+
+    std::vector<size_t> ref_indices;
+    for (size_t i = 0; i < 100; i++) {
+        ref_indices.push_back(i);
+    }
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(inliers->points_.size(), 100u);
+}
+
+TEST(PointCloud, RemoveStatisticalOutliers) {
+    geometry::PointCloud pc;
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            pc.points_.push_back(Eigen::Vector3d(x, y, 0) * 0.1);
+        }
+    }
+    pc.points_.push_back(Eigen::Vector3d(5, 5, 5));
+
+    std::shared_ptr<geometry::PointCloud> inliers;
+    std::vector<size_t> indices;
+    std::tie(inliers, indices) = pc.RemoveStatisticalOutliers(4, 1.0);
+
+    EXPECT_EQ(indices.size(), 100u);
+    EXPECT_EQ(indices.back(), 99u);
+
+    // Duplicated points have an average distance of zero. They are removed,
+    // but still count towards the mean and the standard deviation.
+    pc.points_.resize(100);
+    pc.points_.resize(120, Eigen::Vector3d(5, 5, 5));
+    std::tie(inliers, indices) = pc.RemoveStatisticalOutliers(4, 2.0);
+    EXPECT_EQ(indices.size(), 100u);
+    EXPECT_EQ(indices.back(), 99u);
+}
+
 TEST(PointCloud, EstimateNormals) {
     vector<Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -734,6 +804,29 @@ TEST(PointCloud, OrientNormalsTowardsCameraLocation) {
     ExpectEQ(ref, pc.normals_);
 }
 
+TEST(PointCloud, OrientNormalsConsistentTangentPlane) {
+    // Fibonacci sphere with estimated normals, which have random signs.
+    geometry::PointCloud pc;
+    int size = 8000;
+    double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < size; i++) {
+        double z = 1.0 - 2.0 * (i + 0.5) / size;
+        double r = std::sqrt(1.0 - z * z);
+        double theta = golden_angle * i;
+        pc.points_.push_back(
+                Vector3d(r * std::cos(theta), r * std::sin(theta), z));
+    }
+    pc.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    for (int i = 0; i < size; i += 3) {
+        pc.normals_[i] *= -1.0;
+    }
+
+    EXPECT_TRUE(pc.OrientNormalsConsistentTangentPlane(10));
+    for (int i = 0; i < size; i++) {
+        EXPECT_GT(pc.normals_[i].dot(pc.points_[i]), 0.0);
+    }
+}
+
 TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     vector<double> ref = {
             157.498711, 127.737235, 113.386920, 192.476725, 134.367386,
@@ -768,6 +861,120 @@ TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     ExpectEQ(ref, distance);
 }
 
+TEST(PointCloud, ComputePointCloudDistanceWithCutoff) {
+    int size = 2000;
+
+    geometry::PointCloud pc0;
+    geometry::PointCloud pc1;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc0.points_.resize(size);
+    pc1.points_.resize(size);
+    Rand(pc0.points_, vmin, vmax, 0);
+    Rand(pc1.points_, vmin, vmax, 1);
+
+    vector<double> ref = pc0.ComputePointCloudDistance(pc1);
+
+    double max_distance = 0.5;
+    for (bool use_grid : {false, true}) {
+        vector<double> distances;
+        vector<int> indices;
+        std::tie(distances, indices) =
+                pc0.ComputePointCloudDistance(pc1, max_distance, use_grid);
+        ASSERT_EQ(distances.size(), pc0.points_.size());
+        for (size_t i = 0; i < pc0.points_.size(); i++) {
+            if (ref[i] < max_distance) {
+                EXPECT_NEAR(distances[i], ref[i], THRESHOLD_1E_6);
+                ASSERT_GE(indices[i], 0);
+                EXPECT_NEAR((pc0.points_[i] - pc1.points_[indices[i]]).norm(),
+                            ref[i], THRESHOLD_1E_6);
+            } else {
+                EXPECT_EQ(indices[i], -1);
+                EXPECT_TRUE(std::isinf(distances[i]));
+            }
+        }
+    }
+
+    vector<double> distances;
+    vector<int> indices;
+    std::tie(distances, indices) = pc0.ComputePointCloudDistance(pc1, 0.0);
+    ExpectEQ(ref, distances);
+
+    // Both searches exclude points exactly at the cutoff, and queries far
+    // outside the grid find nothing.
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+    source.points_ = {{0, 0, 0}, {1e12, 0, 0}, {-1e300, 0, 0}};
+    target.points_ = {{1, 0, 0}, {2, 0, 0}};
+    for (bool use_grid : {false, true}) {
+        std::tie(distances, indices) =
+                source.ComputePointCloudDistance(target, 1.0, use_grid);
+        ExpectEQ(vector<int>({-1, -1, -1}), indices);
+        std::tie(distances, indices) =
+                source.ComputePointCloudDistance(target, 1.5, use_grid);
+        ExpectEQ(vector<int>({0, -1, -1}), indices);
+    }
+}
+
+TEST(PointCloud, HiddenPointRemovalBySectors) {
+    geometry::PointCloud pc;
+    int n = 60;
+    double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < n; i++) {
+        double z = 1.0 - 2.0 * (i + 0.5) / n;
+        double r = std::sqrt(1.0 - z * z);
+        double theta = golden_angle * i;
+        pc.points_.push_back(Vector3d(r * cos(theta), r * sin(theta), z));
+    }
+    Vector3d camera(0.0, 0.0, 3.0);
+    double radius = 100.0;
+
+    vector<size_t> exact = std::get<1>(pc.HiddenPointRemoval(camera, radius));
+    sort(exact.begin(), exact.end());
+
+    // All points lie on a single cube map face, so one sector per face gives
+    // the exact result.
+    EXPECT_EQ(exact, pc.HiddenPointRemovalBySectors(camera, radius, 1));
+
+    vector<size_t> visible = pc.HiddenPointRemovalBySectors(camera, radius, 2);
+    EXPECT_TRUE(includes(visible.begin(), visible.end(), exact.begin(),
+                         exact.end()));
+    EXPECT_LT(visible.size(), pc.points_.size());
+}
+
+TEST(PointCloud, HiddenPointRemovalZBuffer) {
+    // A 20 x 20 grid in front of a grid that projects to the same pixels.
+    geometry::PointCloud pc;
+    for (double z : {2.0, 4.0}) {
+        for (int v = 0; v < 20; v++) {
+            for (int u = 0; u < 20; u++) {
+                double x = (u - 9.5) * 0.05 * z;
+                double y = (v - 9.5) * 0.05 * z;
+                pc.points_.push_back(Vector3d(x, y, z));
+            }
+        }
+    }
+    // Behind the camera and outside of the image.
+    pc.points_.push_back(Vector3d(0.0, 0.0, -1.0));
+    pc.points_.push_back(Vector3d(10.0, 0.0, 1.0));
+    camera::PinholeCameraIntrinsic intrinsic(20, 20, 20.0, 20.0, 9.5, 9.5);
+
+    vector<size_t> ref(400);
+    iota(ref.begin(), ref.end(), 0);
+    EXPECT_EQ(ref, pc.HiddenPointRemovalZBuffer(intrinsic));
+
+    // Looking from the other side, the far grid is in front.
+    Matrix4d extrinsic = Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            AngleAxisd(M_PI, Vector3d::UnitY()).toRotationMatrix();
+    extrinsic(2, 3) = 8.0;
+    iota(ref.begin(), ref.end(), 400);
+    vector<size_t> visible = pc.HiddenPointRemovalZBuffer(intrinsic, extrinsic);
+    EXPECT_EQ(ref, visible);
+}
+
 TEST(PointCloud, ComputePointCloudMeanAndCovariance) {
     int size = 40;
     geometry::PointCloud pc;
@@ -963,6 +1170,60 @@ void TEST_CreatePointCloudFromRGBDImage(const int& color_num_of_channels,
 // color_num_of_channels = 3
 // color_bytes_per_channel = 1
 // ----------------------------------------------------------------------------
+TEST(PointCloud, UpdateFromDepthImage) {
+    geometry::Image depth;
+    int width = 7;
+    int height = 5;
+    depth.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *depth.PointerAt<float>(u, v) = ((u + v) % 3 == 0) ? 0.0f
+                                                               : 0.5f * u + v;
+        }
+    }
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 5.0, 6.0, 3.0,
+                                             2.0);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.2, 0.3);
+    Eigen::Matrix4d pose = extrinsic.inverse();
+
+    geometry::PointCloud pc;
+    pc.normals_.resize(3);
+    int stride = 2;
+    EXPECT_TRUE(pc.UpdateFromDepthImage(depth, intrinsic, extrinsic, 1000.0,
+                                        1000.0, stride, false));
+    EXPECT_FALSE(pc.HasNormals());
+    EXPECT_EQ(pc.points_.size(), 12u);
+    size_t cnt = 0;
+    size_t num_valid = 0;
+    for (int v = 0; v < height; v += stride) {
+        for (int u = 0; u < width; u += stride, cnt++) {
+            double z = *depth.PointerAt<float>(u, v);
+            if (z <= 0) {
+                EXPECT_TRUE(std::isnan(pc.points_[cnt](0)));
+                continue;
+            }
+            Eigen::Vector4d point =
+                    pose * Eigen::Vector4d((u - 3.0) * z / 5.0,
+                                           (v - 2.0) * z / 6.0, z, 1.0);
+            ExpectEQ(Eigen::Vector3d(point.block<3, 1>(0, 0)),
+                     pc.points_[cnt]);
+            num_valid++;
+        }
+    }
+
+    // Reusing the point cloud for valid depth only.
+    EXPECT_TRUE(pc.UpdateFromDepthImage(depth, intrinsic, extrinsic, 1000.0,
+                                        1000.0, stride, true));
+    EXPECT_EQ(pc.points_.size(), num_valid);
+    auto created = geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsic, extrinsic, 1000.0, 1000.0, stride, true);
+    ExpectEQ(created->points_, pc.points_);
+}
+
 TEST(PointCloud, CreatePointCloudFromRGBDImage_3_1) {
     vector<Vector3d> ref_points = {
             {-0.000337, -0.000252, 0.000553}, {-0.000283, -0.000213, 0.000467},
@@ -1057,6 +1318,31 @@ TEST(PointCloud, CreatePointCloudFromRGBDImage_1_4) {
                                        ref_colors);
 }
 
+TEST(PointCloud, ClusterDBSCAN) {
+    // Three well separated blobs and isolated noise points.
+    geometry::PointCloud pc;
+    vector<Vector3d> centers = {{0.0, 0.0, 0.0}, {5.0, 0.0, 0.0},
+                                {0.0, 5.0, 5.0}};
+    for (const auto &center : centers) {
+        vector<Vector3d> blob(200);
+        Rand(blob, Vector3d(-0.5, -0.5, -0.5), Vector3d(0.5, 0.5, 0.5), 0);
+        for (const auto &point : blob) {
+            pc.points_.push_back(center + point);
+        }
+    }
+    pc.points_.push_back(Vector3d(10.0, 10.0, 10.0));
+    pc.points_.push_back(Vector3d(-10.0, 3.0, 2.0));
+
+    vector<int> labels = pc.ClusterDBSCAN(0.5, 5);
+    vector<int> labels_grid = pc.ClusterDBSCAN(0.5, 5, false, true);
+    ExpectEQ(labels, labels_grid);
+    EXPECT_EQ(labels_grid[600], -1);
+    EXPECT_EQ(labels_grid[601], -1);
+    for (int i = 0; i < 600; i++) {
+        EXPECT_EQ(labels_grid[i], i / 200);
+    }
+}
+
 TEST(PointCloud, SegmentPlane) {
     // Points sampled from the plane x + y + z + 1 = 0
     vector<Vector3d> ref = {{1.0, 1.0, -3.0},
@@ -1078,3 +1364,43 @@ TEST(PointCloud, SegmentPlane) {
 
     ExpectEQ(ref, output_pc->points_);
 }
+
+TEST(PointCloud, SegmentPlanes) {
+    // Three disjoint axis aligned patches of decreasing size, and a few points
+    // off every plane.
+    geometry::PointCloud pc;
+    const int sizes[3] = {20, 15, 10};
+    for (int axis = 0; axis < 3; axis++) {
+        for (int i = 0; i < sizes[axis]; i++) {
+            for (int j = 0; j < sizes[axis]; j++) {
+                Vector3d p(1.0 + i * 0.05, 1.0 + j * 0.05, 0.0);
+                pc.points_.push_back(Vector3d(p((3 - axis) % 3),
+                                              p((4 - axis) % 3),
+                                              p((5 - axis) % 3)));
+            }
+        }
+    }
+    pc.points_.push_back(Vector3d(0.5, 0.7, 0.3));
+    pc.points_.push_back(Vector3d(0.3, 0.5, 0.7));
+
+    auto planes = pc.SegmentPlanes(5, 0.01, 3, 1000, 50);
+    ASSERT_EQ(planes.size(), 3u);
+    std::vector<size_t> all_inliers;
+    for (int axis = 0; axis < 3; axis++) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = planes[axis];
+        EXPECT_EQ(inliers.size(), size_t(sizes[axis] * sizes[axis]));
+        // The normal of the k-th plane is the k-th axis.
+        Eigen::Vector3d normal = plane_model.head<3>();
+        EXPECT_NEAR(std::abs(normal((2 + axis) % 3)), 1.0, 1e-6);
+        EXPECT_NEAR(plane_model(3), 0.0, 1e-6);
+        for (size_t idx : inliers) {
+            EXPECT_NEAR(pc.points_[idx]((2 + axis) % 3), 0.0, 1e-12);
+        }
+        all_inliers.insert(all_inliers.end(), inliers.begin(), inliers.end());
+    }
+    std::sort(all_inliers.begin(), all_inliers.end());
+    EXPECT_TRUE(std::unique(all_inliers.begin(), all_inliers.end()) ==
+                all_inliers.end());
+}
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -640,6 +644,86 @@ TEST(TriangleMesh, Purge) {
     ExpectEQ(ref_triangle_normals, tm.triangle_normals_);
 }
 
+TEST(TriangleMesh, CleanMesh) {
+    // A sphere with duplicated vertices, rotated and flipped copies of its
+    // triangles, degenerate triangles, unreferenced and NaN vertices.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::TriangleMesh mesh = *sphere;
+    int num_vertices = int(mesh.vertices_.size());
+    int num_triangles = int(mesh.triangles_.size());
+    for (int vidx = 0; vidx < num_vertices; vidx += 3) {
+        mesh.vertices_.push_back(mesh.vertices_[vidx]);
+    }
+    mesh.vertices_.push_back(Vector3d(5, 5, 5));
+    mesh.vertices_.push_back(Vector3d(NAN, 0, 0));
+    mesh.vertices_.push_back(Vector3d(NAN, 0, 0));
+    for (int tidx = 0; tidx < num_triangles; tidx += 2) {
+        Vector3i triangle = mesh.triangles_[tidx];
+        mesh.triangles_.push_back(
+                Vector3i(triangle(1), triangle(2), triangle(0)));
+        mesh.triangles_.push_back(
+                Vector3i(triangle(0), triangle(2), triangle(1)));
+        mesh.triangles_.push_back(
+                Vector3i(triangle(0), triangle(0), triangle(1)));
+    }
+    int num_copies = (num_vertices + 2) / 3;
+    for (int i = 0; i < num_copies; i += 2) {
+        mesh.triangles_.push_back(Vector3i(num_vertices + i,
+                                           (3 * i + 1) % num_vertices,
+                                           (3 * i + 2) % num_vertices));
+    }
+    mesh.triangles_.push_back(Vector3i(num_vertices + num_copies + 1,
+                                       num_vertices + num_copies + 2, 0));
+    mesh.vertex_normals_.resize(mesh.vertices_.size());
+    mesh.vertex_colors_.resize(mesh.vertices_.size());
+    mesh.triangle_normals_.resize(mesh.triangles_.size());
+    Rand(mesh.vertex_normals_, Vector3d(-1, -1, -1), Vector3d(1, 1, 1), 0);
+    Rand(mesh.vertex_colors_, Vector3d(0, 0, 0), Vector3d(1, 1, 1), 1);
+    Rand(mesh.triangle_normals_, Vector3d(-1, -1, -1), Vector3d(1, 1, 1), 2);
+
+    for (int flags = 0; flags < 16; ++flags) {
+        geometry::TriangleMesh ref = mesh;
+        if (flags & 1) ref.RemoveDuplicatedVertices();
+        if (flags & 2) ref.RemoveDegenerateTriangles();
+        if (flags & 4) ref.RemoveDuplicatedTriangles();
+        if (flags & 8) ref.RemoveUnreferencedVertices();
+
+        geometry::TriangleMesh cleaned = mesh;
+        cleaned.CleanMesh(flags & 1, flags & 2, flags & 4, flags & 8);
+        EXPECT_EQ(ref.vertices_.size(), cleaned.vertices_.size());
+        for (size_t vidx = 0; vidx < ref.vertices_.size(); ++vidx) {
+            if (ref.vertices_[vidx].hasNaN()) {
+                EXPECT_TRUE(cleaned.vertices_[vidx].hasNaN());
+            } else {
+                ExpectEQ(ref.vertices_[vidx], cleaned.vertices_[vidx]);
+            }
+        }
+        ExpectEQ(ref.vertex_normals_, cleaned.vertex_normals_);
+        ExpectEQ(ref.vertex_colors_, cleaned.vertex_colors_);
+        ExpectEQ(ref.triangles_, cleaned.triangles_);
+        ExpectEQ(ref.triangle_normals_, cleaned.triangle_normals_);
+    }
+
+    // Triangle uvs and the adjacency list follow the compaction.
+    mesh.triangle_uvs_.resize(3 * mesh.triangles_.size());
+    for (size_t i = 0; i < mesh.triangle_uvs_.size(); ++i) {
+        mesh.triangle_uvs_[i] = Vector2d(double(i), 0);
+    }
+    mesh.ComputeAdjacencyList();
+    geometry::TriangleMesh ref = mesh;
+    ref.RemoveDuplicatedVertices();
+    ref.RemoveDegenerateTriangles();
+    ref.RemoveDuplicatedTriangles();
+    ref.RemoveUnreferencedVertices();
+    mesh.CleanMesh();
+    ExpectEQ(ref.triangles_, mesh.triangles_);
+    EXPECT_EQ(3 * mesh.triangles_.size(), mesh.triangle_uvs_.size());
+    for (size_t i = 0; i < mesh.triangle_uvs_.size(); ++i) {
+        EXPECT_EQ(i % 3, size_t(mesh.triangle_uvs_[i](0)) % 3);
+    }
+    EXPECT_TRUE(mesh.HasAdjacencyList());
+}
+
 TEST(TriangleMesh, MergeCloseVertices) {
     geometry::TriangleMesh mesh;
     mesh.vertices_ = {{0.000000, 0.000000, 0.000000},
@@ -751,6 +835,112 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsDeterministic) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->ComputeVertexNormals();
+
+    // The same seed gives the same points for any number of threads.
+    vector<shared_ptr<geometry::PointCloud>> uniform;
+    vector<shared_ptr<geometry::PointCloud>> poisson;
+    for (int num_threads : {1, 4}) {
+#ifdef _OPENMP
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(num_threads);
+#else
+        (void)num_threads;
+#endif
+        uniform.push_back(mesh->SamplePointsUniformly(1000, false, 3));
+        poisson.push_back(
+                mesh->SamplePointsPoissonDisk(500, 5, nullptr, false, 3));
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+    }
+    ExpectEQ(uniform[0]->points_, uniform[1]->points_, 0.0);
+    ExpectEQ(uniform[0]->normals_, uniform[1]->normals_, 0.0);
+    ExpectEQ(poisson[0]->points_, poisson[1]->points_, 0.0);
+    for (const Vector3d &point : uniform[0]->points_) {
+        EXPECT_NEAR(1.0, point.norm(), 0.02);
+    }
+
+    auto other = mesh->SamplePointsUniformly(1000, false, 4);
+    EXPECT_FALSE(other->points_ == uniform[0]->points_);
+}
+
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    auto poisson = mesh->SamplePointsPoissonDisk(500, 5, nullptr, false, 1);
+    auto uniform = mesh->SamplePointsUniformly(500, false, 1);
+    EXPECT_EQ(500u, poisson->points_.size());
+
+    // Sample elimination spreads the points further apart.
+    auto MinDistance = [](const geometry::PointCloud &pcd) {
+        double distance = numeric_limits<double>::infinity();
+        for (size_t i = 0; i < pcd.points_.size(); i++) {
+            for (size_t j = i + 1; j < pcd.points_.size(); j++) {
+                distance = min(distance,
+                               (pcd.points_[i] - pcd.points_[j]).norm());
+            }
+        }
+        return distance;
+    };
+    EXPECT_GT(MinDistance(*poisson), 2 * MinDistance(*uniform));
+}
+
+TEST(TriangleMesh, SubdivideMidpoint) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+    auto subdivided = mesh.SubdivideMidpoint(1);
+
+    vector<Vector3d> ref_vertices = {{0, 0, 0},     {1, 0, 0},   {0, 1, 0},
+                                     {1, 1, 0},     {0.5, 0, 0}, {0.5, 0.5, 0},
+                                     {0, 0.5, 0},   {1, 0.5, 0}, {0.5, 1, 0}};
+    vector<Vector3i> ref_triangles = {{0, 4, 6}, {4, 1, 5}, {5, 2, 6},
+                                      {4, 5, 6}, {2, 5, 8}, {5, 1, 7},
+                                      {7, 3, 8}, {5, 7, 8}};
+    ExpectEQ(ref_vertices, subdivided->vertices_);
+    ExpectEQ(ref_triangles, subdivided->triangles_);
+
+    // Every edge gets exactly one new vertex.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    size_t num_vertices = sphere->vertices_.size();
+    size_t num_triangles = sphere->triangles_.size();
+    size_t num_edges = num_vertices + num_triangles - 2;
+    auto sphere_subdivided = sphere->SubdivideMidpoint(2);
+    EXPECT_EQ(num_vertices + num_edges + (2 * num_edges + 3 * num_triangles),
+              sphere_subdivided->vertices_.size());
+    EXPECT_EQ(16 * num_triangles, sphere_subdivided->triangles_.size());
+    EXPECT_TRUE(sphere_subdivided->IsEdgeManifold());
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}, {5, 5, 5}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+    auto subdivided = mesh.SubdivideLoop(1);
+
+    // Boundary vertices and edges use the boundary rules, the interior edge
+    // (1, 2) uses both opposite vertices, and the unused vertex 4 is kept.
+    vector<Vector3d> ref_vertices = {
+            {0.125, 0.125, 0}, {0.875, 0.125, 0}, {0.125, 0.875, 0},
+            {0.875, 0.875, 0}, {5, 5, 5},         {0.5, 0, 0},
+            {0.5, 0.5, 0},     {0, 0.5, 0},       {1, 0.5, 0},
+            {0.5, 1, 0}};
+    ExpectEQ(ref_vertices, subdivided->vertices_);
+    EXPECT_EQ(8u, subdivided->triangles_.size());
+
+    // Loop subdivision shrinks a closed mesh towards its limit surface.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto sphere_subdivided = sphere->SubdivideLoop(2);
+    EXPECT_EQ(sphere->SubdivideMidpoint(2)->vertices_.size(),
+              sphere_subdivided->vertices_.size());
+    for (const auto &vertex : sphere_subdivided->vertices_) {
+        EXPECT_LE(vertex.norm(), 1.0 + 1e-9);
+        EXPECT_GT(vertex.norm(), 0.9);
+    }
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -833,6 +1023,130 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+TEST(TriangleMesh, FilterSmoothLaplacianCotangent) {
+    // A planar grid of right triangles. Cotangent weights reproduce linear
+    // functions, so interior vertices stay in place while the boundary
+    // shrinks.
+    int n = 5;
+    geometry::TriangleMesh mesh;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            mesh.vertices_.push_back(Vector3d(x, y, 0));
+        }
+    }
+    for (int y = 0; y + 1 < n; ++y) {
+        for (int x = 0; x + 1 < n; ++x) {
+            int v = y * n + x;
+            mesh.triangles_.push_back(Vector3i(v, v + 1, v + n + 1));
+            mesh.triangles_.push_back(Vector3i(v, v + n + 1, v + n));
+        }
+    }
+
+    auto smoothed = mesh.FilterSmoothLaplacian(
+            1, 0.5, geometry::MeshBase::FilterScope::All, true);
+    for (int y = 1; y + 1 < n; ++y) {
+        for (int x = 1; x + 1 < n; ++x) {
+            ExpectEQ(mesh.vertices_[y * n + x],
+                     smoothed->vertices_[y * n + x]);
+        }
+    }
+    EXPECT_GT((smoothed->vertices_[0] - mesh.vertices_[0]).norm(), 1e-3);
+}
+
+TEST(TriangleMesh, FilterVertexSubset) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh->ComputeVertexNormals();
+    vector<size_t> vertex_indices;
+    for (size_t vidx = 0; vidx < mesh->vertices_.size(); vidx += 2) {
+        vertex_indices.push_back(vidx);
+    }
+
+    // Subset filters leave the other vertices untouched.
+    auto subset = mesh->FilterSmoothTaubin(
+            1, 0.5, -0.53, geometry::MeshBase::FilterScope::All, false,
+            vertex_indices);
+    auto sharpened = mesh->FilterSharpen(
+            2, 0.1, geometry::MeshBase::FilterScope::All, vertex_indices);
+    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+        if (vidx % 2 == 1) {
+            ExpectEQ(mesh->vertices_[vidx], subset->vertices_[vidx]);
+            ExpectEQ(mesh->vertex_normals_[vidx],
+                     subset->vertex_normals_[vidx]);
+            ExpectEQ(mesh->vertices_[vidx], sharpened->vertices_[vidx]);
+        }
+    }
+
+    // A single pass of a subset filter matches the full filter on the subset.
+    auto simple = mesh->FilterSmoothSimple(
+            1, geometry::MeshBase::FilterScope::All, vertex_indices);
+    auto simple_full = mesh->FilterSmoothSimple(1);
+    for (size_t vidx : vertex_indices) {
+        ExpectEQ(simple_full->vertices_[vidx], simple->vertices_[vidx]);
+    }
+
+    // Values outside the filter scope are kept for any iteration count.
+    auto smoothed = mesh->FilterSmoothSimple(
+            2, geometry::MeshBase::FilterScope::Vertex);
+    ExpectEQ(mesh->vertex_normals_, smoothed->vertex_normals_);
+
+    EXPECT_ANY_THROW(mesh->FilterSmoothSimple(
+            1, geometry::MeshBase::FilterScope::All,
+            {mesh->vertices_.size()}));
+}
+
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    int target = int(sphere->triangles_.size()) / 4;
+    for (bool use_independent_sets : {false, true}) {
+        auto simplified =
+                sphere->SimplifyQuadricDecimation(target, use_independent_sets);
+        EXPECT_LE(int(simplified->triangles_.size()), target);
+        EXPECT_GT(int(simplified->triangles_.size()), target / 2);
+        EXPECT_LT(simplified->vertices_.size(), sphere->vertices_.size());
+        EXPECT_EQ(simplified->vertices_.size(),
+                  simplified->vertex_normals_.size());
+        for (const auto &vertex : simplified->vertices_) {
+            EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+        }
+        for (const auto &triangle : simplified->triangles_) {
+            EXPECT_GE(triangle.minCoeff(), 0);
+            EXPECT_LT(triangle.maxCoeff(), int(simplified->vertices_.size()));
+        }
+        simplified->ComputeTriangleNormals();
+        simplified->ComputeVertexNormals();
+        for (size_t vidx = 0; vidx < simplified->vertices_.size(); ++vidx) {
+            EXPECT_GT(simplified->vertex_normals_[vidx].dot(
+                              simplified->vertices_[vidx]),
+                      0.5);
+        }
+    }
+
+    // A planar grid stays planar.
+    int n = 20;
+    geometry::TriangleMesh grid;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            grid.vertices_.push_back(Vector3d(x, y, 0));
+        }
+    }
+    for (int y = 0; y + 1 < n; ++y) {
+        for (int x = 0; x + 1 < n; ++x) {
+            int v = y * n + x;
+            grid.triangles_.push_back(Vector3i(v, v + 1, v + n + 1));
+            grid.triangles_.push_back(Vector3i(v, v + n + 1, v + n));
+        }
+    }
+    for (bool use_independent_sets : {false, true}) {
+        auto simplified =
+                grid.SimplifyQuadricDecimation(100, use_independent_sets);
+        EXPECT_LE(simplified->triangles_.size(), 100u);
+        for (const auto &vertex : simplified->vertices_) {
+            EXPECT_NEAR(vertex(2), 0.0, 1e-9);
+        }
+    }
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1573,6 +1887,41 @@ TEST(TriangleMesh, SelectByIndex) {
     ExpectEQ(ref_triangle_normals, output_tm->triangle_normals_);
 }
 
+TEST(TriangleMesh, SelectByIndexInPlace) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->ComputeVertexNormals();
+    mesh->ComputeAdjacencyList();
+    vector<size_t> indices;
+    for (size_t vidx = 0; vidx < mesh->vertices_.size(); vidx++) {
+        if (mesh->vertices_[vidx](2) > -0.3) indices.push_back(vidx);
+    }
+
+    auto ref = mesh->SelectByIndex(indices);
+    mesh->SelectByIndexInPlace(indices);
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    ExpectEQ(ref->vertices_, mesh->vertices_);
+    ExpectEQ(ref->vertex_normals_, mesh->vertex_normals_);
+    ExpectEQ(ref->triangles_, mesh->triangles_);
+    ExpectEQ(ref->triangle_normals_, mesh->triangle_normals_);
+    EXPECT_EQ(mesh->vertices_.size(), mesh->adjacency_list_.size());
+}
+
+TEST(TriangleMesh, SelectByIndexDegenerate) {
+    // Vertex 3 duplicates vertex 1, so the second triangle becomes
+    // degenerate. It is removed after the unreferenced vertices, so its
+    // vertex 4 is kept.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 0, 0}, {5, 5, 5}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 3, 4}};
+    auto selected = mesh.SelectByIndex({0, 1, 2, 3, 4});
+
+    vector<Vector3d> ref_vertices = {
+            {0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {5, 5, 5}};
+    vector<Vector3i> ref_triangles = {{0, 1, 2}};
+    ExpectEQ(ref_vertices, selected->vertices_);
+    ExpectEQ(ref_triangles, selected->triangles_);
+}
+
 TEST(TriangleMesh, CropTriangleMesh) {
     vector<Vector3d> ref_vertices = {{615.686275, 639.215686, 517.647059},
                                      {615.686275, 760.784314, 772.549020},
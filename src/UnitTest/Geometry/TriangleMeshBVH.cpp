@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <limits>
+
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+/// Small random triangles in the unit cube, many of which intersect.
+geometry::TriangleMesh RandomTriangleSoup(int num_triangles, int seed) {
+    geometry::TriangleMesh mesh;
+    vector<Vector3d> centers(num_triangles);
+    Rand(centers, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), seed);
+    vector<Vector3d> offsets(3 * num_triangles);
+    Rand(offsets, Vector3d(-0.1, -0.1, -0.1), Vector3d(0.1, 0.1, 0.1),
+         seed + 1);
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        for (int i = 0; i < 3; i++) {
+            mesh.vertices_.push_back(centers[tidx] + offsets[3 * tidx + i]);
+        }
+        mesh.triangles_.push_back(
+                Vector3i(3 * tidx, 3 * tidx + 1, 3 * tidx + 2));
+    }
+    return mesh;
+}
+
+}  // unnamed namespace
+
+TEST(TriangleMeshBVH, Empty) {
+    geometry::TriangleMesh mesh;
+    geometry::TriangleMeshBVH bvh(mesh);
+    EXPECT_EQ(bvh.NumTriangles(), 0u);
+    double t;
+    EXPECT_EQ(bvh.CastRay(Vector3d::Zero(), Vector3d::UnitZ(), t), -1);
+    Vector3d closest_point;
+    double distance2;
+    EXPECT_EQ(bvh.ComputeClosestPoint(Vector3d::Zero(), closest_point,
+                                      distance2),
+              -1);
+    EXPECT_TRUE(bvh.ComputeSelfIntersections().empty());
+    EXPECT_TRUE(mesh.GetSelfIntersectingTriangles().empty());
+}
+
+TEST(TriangleMeshBVH, QueryBoundingBox) {
+    auto mesh = RandomTriangleSoup(500, 0);
+    geometry::TriangleMeshBVH bvh(mesh);
+    Vector3d min_bound(0.2, 0.3, 0.1);
+    Vector3d max_bound(0.6, 0.5, 0.7);
+
+    vector<int> ref;
+    for (int tidx = 0; tidx < int(mesh.triangles_.size()); tidx++) {
+        const Vector3i &triangle = mesh.triangles_[tidx];
+        Vector3d tmin = mesh.vertices_[triangle(0)]
+                                .cwiseMin(mesh.vertices_[triangle(1)])
+                                .cwiseMin(mesh.vertices_[triangle(2)]);
+        Vector3d tmax = mesh.vertices_[triangle(0)]
+                                .cwiseMax(mesh.vertices_[triangle(1)])
+                                .cwiseMax(mesh.vertices_[triangle(2)]);
+        if (geometry::IntersectionTest::AABBAABB(min_bound, max_bound, tmin,
+                                                 tmax)) {
+            ref.push_back(tidx);
+        }
+    }
+    EXPECT_FALSE(ref.empty());
+    EXPECT_EQ(ref, bvh.QueryBoundingBox(min_bound, max_bound));
+}
+
+TEST(TriangleMeshBVH, ComputeClosestPoint) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    vector<Vector3d> queries(200);
+    Rand(queries, Vector3d(-2.0, -2.0, -2.0), Vector3d(2.0, 2.0, 2.0), 0);
+
+    for (const auto &query : queries) {
+        double ref_distance2 = numeric_limits<double>::infinity();
+        for (const auto &triangle : mesh->triangles_) {
+            Vector3d point =
+                    geometry::IntersectionTest::PointTriangleClosestPoint(
+                            query, mesh->vertices_[triangle(0)],
+                            mesh->vertices_[triangle(1)],
+                            mesh->vertices_[triangle(2)]);
+            ref_distance2 = min(ref_distance2, (point - query).squaredNorm());
+        }
+        Vector3d closest_point;
+        double distance2;
+        int tidx = bvh.ComputeClosestPoint(query, closest_point, distance2);
+        ASSERT_GE(tidx, 0);
+        EXPECT_NEAR(ref_distance2, distance2, THRESHOLD_1E_6);
+        EXPECT_NEAR((closest_point - query).squaredNorm(), distance2,
+                    THRESHOLD_1E_6);
+
+        // A cutoff below the closest distance finds nothing.
+        double cutoff = sqrt(ref_distance2) * 0.99;
+        EXPECT_EQ(bvh.ComputeClosestPoint(query, closest_point, distance2,
+                                          cutoff),
+                  -1);
+    }
+}
+
+TEST(TriangleMeshBVH, CastRay) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    vector<Vector3d> origins(200);
+    Rand(origins, Vector3d(-3.0, -3.0, -3.0), Vector3d(3.0, 3.0, 3.0), 0);
+    vector<Vector3d> targets(200);
+    Rand(targets, Vector3d(-1.5, -1.5, -1.5), Vector3d(1.5, 1.5, 1.5), 1);
+
+    int num_hits = 0;
+    for (size_t i = 0; i < origins.size(); i++) {
+        Vector3d direction = targets[i] - origins[i];
+        double ref_t = numeric_limits<double>::infinity();
+        for (const auto &triangle : mesh->triangles_) {
+            double t = geometry::IntersectionTest::RayTriangle(
+                    origins[i], direction, mesh->vertices_[triangle(0)],
+                    mesh->vertices_[triangle(1)],
+                    mesh->vertices_[triangle(2)]);
+            if (t >= 0) ref_t = min(ref_t, t);
+        }
+        double t;
+        int tidx = bvh.CastRay(origins[i], direction, t);
+        if (ref_t == numeric_limits<double>::infinity()) {
+            EXPECT_EQ(tidx, -1);
+        } else {
+            EXPECT_GE(tidx, 0);
+            EXPECT_NEAR(ref_t, t, THRESHOLD_1E_6);
+            num_hits++;
+        }
+    }
+    EXPECT_GT(num_hits, 50);
+}
+
+TEST(TriangleMeshBVH, CastRayAxisAligned) {
+    // Regular grid in the z = 0 plane, so leaf boxes share faces.
+    geometry::TriangleMesh mesh;
+    const int n = 8;
+    for (int y = 0; y <= n; y++) {
+        for (int x = 0; x <= n; x++) {
+            mesh.vertices_.push_back(Vector3d(x, y, 0));
+        }
+    }
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            int v0 = y * (n + 1) + x;
+            mesh.triangles_.push_back(Vector3i(v0, v0 + 1, v0 + n + 2));
+            mesh.triangles_.push_back(Vector3i(v0, v0 + n + 2, v0 + n + 1));
+        }
+    }
+    geometry::TriangleMeshBVH bvh(mesh);
+
+    // Rays along +z through cell centers, edges and vertices.
+    for (int y = 0; y <= 2 * n; y++) {
+        for (int x = 0; x <= 2 * n; x++) {
+            Vector3d origin(0.5 * x, 0.5 * y, -1);
+            double t;
+            int tidx = bvh.CastRay(origin, Vector3d(0, 0, 1), t);
+            EXPECT_GE(tidx, 0);
+            EXPECT_NEAR(1.0, t, THRESHOLD_1E_6);
+        }
+    }
+
+    // Rays along +x within the plane of the mesh are parallel to it, and
+    // rays beside the grid miss it.
+    double t;
+    EXPECT_EQ(-1, bvh.CastRay(Vector3d(-1, 1, 0), Vector3d(1, 0, 0), t));
+    EXPECT_EQ(-1, bvh.CastRay(Vector3d(n + 1, 1, -1), Vector3d(0, 0, 1), t));
+}
+
+TEST(TriangleMeshBVH, ComputeSelfIntersections) {
+    auto mesh = RandomTriangleSoup(400, 0);
+    // Two triangles sharing a vertex are not reported.
+    mesh.triangles_.push_back(Vector3i(0, 4, 5));
+
+    vector<Vector2i> ref;
+    for (int tidx0 = 0; tidx0 < int(mesh.triangles_.size()); tidx0++) {
+        const Vector3i &p = mesh.triangles_[tidx0];
+        for (int tidx1 = tidx0 + 1; tidx1 < int(mesh.triangles_.size());
+             tidx1++) {
+            const Vector3i &q = mesh.triangles_[tidx1];
+            bool shared = false;
+            for (int i = 0; i < 3; i++) {
+                shared |= p(i) == q(0) || p(i) == q(1) || p(i) == q(2);
+            }
+            if (!shared &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                ref.push_back(Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    EXPECT_FALSE(ref.empty());
+    ExpectEQ(ref, mesh.GetSelfIntersectingTriangles());
+}
+
+TEST(TriangleMeshBVH, IsIntersecting) {
+    auto sphere0 = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto sphere1 = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere1->Translate(Vector3d(1.5, 0.0, 0.0));
+    EXPECT_TRUE(geometry::TriangleMeshBVH(*sphere0).IsIntersecting(*sphere1));
+    EXPECT_TRUE(sphere0->IsIntersecting(*sphere1));
+    EXPECT_TRUE(sphere1->IsIntersecting(*sphere0));
+
+    // Nested spheres do not intersect, although their boxes overlap.
+    auto sphere2 = geometry::TriangleMesh::CreateSphere(0.5, 10);
+    EXPECT_FALSE(sphere0->IsIntersecting(*sphere2));
+    EXPECT_FALSE(sphere2->IsIntersecting(*sphere0));
+}
+
+TEST(TriangleMeshBVH, ComputeClosestPoints) {
+    // The box spans [0, 1]^3 and has outward facing triangles.
+    auto mesh = geometry::TriangleMesh::CreateBox();
+    geometry::TriangleMeshBVH bvh(*mesh);
+    vector<Vector3d> queries(1000);
+    Rand(queries, Vector3d(-1.0, -1.0, -1.0), Vector3d(2.0, 2.0, 2.0), 0);
+    // Queries exactly above a vertex and an edge.
+    queries.push_back(Vector3d(1.5, 1.5, 1.5));
+    queries.push_back(Vector3d(0.5, -0.5, -0.5));
+
+    auto result = bvh.ComputeClosestPoints(queries, true);
+    ASSERT_EQ(result.distances_.size(), queries.size());
+    Vector3d center(0.5, 0.5, 0.5);
+    for (size_t i = 0; i < queries.size(); i++) {
+        Vector3d d = (queries[i] - center).cwiseAbs() - Vector3d::Constant(0.5);
+        double ref = d.maxCoeff() > 0 ? d.cwiseMax(0.0).norm() : d.maxCoeff();
+        EXPECT_NEAR(ref, result.distances_[i], THRESHOLD_1E_6);
+
+        int tidx = result.triangle_indices_[i];
+        ASSERT_GE(tidx, 0);
+        const Vector3i &triangle = mesh->triangles_[tidx];
+        const Vector3d &barycentric = result.barycentric_coordinates_[i];
+        EXPECT_NEAR(barycentric.sum(), 1.0, THRESHOLD_1E_6);
+        Vector3d point = barycentric(0) * mesh->vertices_[triangle(0)] +
+                         barycentric(1) * mesh->vertices_[triangle(1)] +
+                         barycentric(2) * mesh->vertices_[triangle(2)];
+        ExpectEQ(result.points_[i], point);
+    }
+
+    // Unsigned distances through the mesh, with a cutoff.
+    result = mesh->ComputeClosestPoints(queries, false, 0.25);
+    for (size_t i = 0; i < queries.size(); i++) {
+        Vector3d d = (queries[i] - center).cwiseAbs() - Vector3d::Constant(0.5);
+        double ref = d.maxCoeff() > 0 ? d.cwiseMax(0.0).norm() : -d.maxCoeff();
+        if (ref <= 0.25) {
+            EXPECT_NEAR(ref, result.distances_[i], THRESHOLD_1E_6);
+        } else {
+            EXPECT_EQ(result.triangle_indices_[i], -1);
+            EXPECT_EQ(result.distances_[i], numeric_limits<double>::infinity());
+        }
+    }
+}
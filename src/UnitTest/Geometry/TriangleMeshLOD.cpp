@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshLOD.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(TriangleMeshLOD, CreateFromTriangleMesh) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    auto lod = geometry::TriangleMeshLOD::CreateFromTriangleMesh(*sphere, 3,
+                                                                 0.25);
+    ASSERT_EQ(3u, lod->NumLevels());
+    EXPECT_EQ(1u, lod->NumTiles());
+    ExpectEQ(sphere->vertices_, lod->GetLevel(0)->vertices_);
+    ExpectEQ(sphere->triangles_, lod->GetLevel(0)->triangles_);
+
+    size_t num_triangles = sphere->triangles_.size();
+    for (size_t level = 1; level < lod->NumLevels(); level++) {
+        auto mesh = lod->GetLevel(level);
+        num_triangles = (num_triangles + 3) / 4;
+        EXPECT_LE(mesh->triangles_.size(), num_triangles);
+        EXPECT_GT(mesh->triangles_.size(), num_triangles - 8);
+        EXPECT_TRUE(mesh->HasVertexNormals());
+        for (const Vector3d &vertex : mesh->vertices_) {
+            EXPECT_NEAR(1.0, vertex.norm(), 0.05);
+        }
+    }
+
+    EXPECT_ANY_THROW(
+            geometry::TriangleMeshLOD::CreateFromTriangleMesh(*sphere, 0));
+    EXPECT_ANY_THROW(geometry::TriangleMeshLOD::CreateFromTriangleMesh(
+            *sphere, 2, 1.0));
+}
+
+TEST(TriangleMeshLOD, Tiles) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    auto lod = geometry::TriangleMeshLOD::CreateFromTriangleMesh(*sphere, 2,
+                                                                 0.25, 1);
+    ASSERT_EQ(2u, lod->NumLevels());
+    ASSERT_EQ(8u, lod->NumTiles());
+    ExpectEQ(Vector3d(-1, -1, -1), lod->origin_);
+    EXPECT_DOUBLE_EQ(1.0, lod->tile_size_);
+
+    // Every triangle is in the tile of its centroid.
+    size_t num_triangles = 0;
+    for (size_t tile = 0; tile < lod->NumTiles(); tile++) {
+        const auto &mesh = *lod->levels_[0][tile];
+        num_triangles += mesh.triangles_.size();
+        auto bound = lod->GetTileBound(tile);
+        for (const Vector3i &triangle : mesh.triangles_) {
+            Vector3d centroid = (mesh.vertices_[triangle(0)] +
+                                 mesh.vertices_[triangle(1)] +
+                                 mesh.vertices_[triangle(2)]) /
+                                3.0;
+            EXPECT_TRUE((centroid.array() >= bound.min_bound_.array()).all());
+            EXPECT_TRUE((centroid.array() <= bound.max_bound_.array()).all());
+        }
+        EXPECT_LT(lod->levels_[1][tile]->triangles_.size(),
+                  mesh.triangles_.size());
+    }
+    EXPECT_EQ(sphere->triangles_.size(), num_triangles);
+    EXPECT_EQ(num_triangles, lod->GetLevel(0)->triangles_.size());
+    EXPECT_ANY_THROW(lod->GetTileBound(lod->NumTiles()));
+}
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VertexAdjacency.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(VertexAdjacency, ComputeFromTriangles) {
+    // Square pyramid, the apex 0 is adjacent to every base vertex.
+    vector<Vector3i> triangles = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4},
+                                  {0, 4, 1}, {1, 2, 4}, {2, 3, 4}};
+    geometry::VertexAdjacency adjacency;
+    EXPECT_TRUE(adjacency.ComputeFromTriangles(6, triangles));
+
+    EXPECT_TRUE(vector<size_t>({0, 4, 7, 11, 14, 18, 18}) ==
+                adjacency.offsets_);
+    ExpectEQ(vector<int>({1, 2, 3, 4, 0, 2, 4, 0, 1, 3, 4, 0, 2, 4, 0, 1, 2,
+                          3}),
+             adjacency.indices_);
+    EXPECT_EQ(6u, adjacency.NumVertices());
+    EXPECT_EQ(0, adjacency.NumNeighbors(5));
+
+    auto adjacency_list = adjacency.ToAdjacencyList();
+    EXPECT_EQ(6u, adjacency_list.size());
+    EXPECT_TRUE(adjacency_list[1] == unordered_set<int>({0, 2, 4}));
+    EXPECT_TRUE(adjacency_list[5].empty());
+
+    triangles.push_back(Vector3i(0, 1, 6));
+    EXPECT_FALSE(adjacency.ComputeFromTriangles(6, triangles));
+    EXPECT_EQ(0u, adjacency.NumVertices());
+}
+
+TEST(VertexAdjacency, ComputeFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::VertexAdjacency adjacency(*mesh);
+    EXPECT_EQ(mesh->vertices_.size(), adjacency.NumVertices());
+    EXPECT_EQ(adjacency.offsets_.back(), adjacency.indices_.size());
+
+    mesh->ComputeAdjacencyList();
+    EXPECT_TRUE(adjacency.ToAdjacencyList() == mesh->adjacency_list_);
+    for (size_t vidx = 0; vidx < adjacency.NumVertices(); vidx++) {
+        const int *neighbors = adjacency.NeighborIndices(vidx);
+        EXPECT_TRUE(is_sorted(neighbors,
+                              neighbors + adjacency.NumNeighbors(vidx)));
+    }
+
+    // An existing adjacency list takes precedence over the triangles.
+    mesh->adjacency_list_[0].insert(int(mesh->vertices_.size()) - 1);
+    adjacency.ComputeFromTriangleMesh(*mesh);
+    EXPECT_TRUE(adjacency.ToAdjacencyList() == mesh->adjacency_list_);
+}
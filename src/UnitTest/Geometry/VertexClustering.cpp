@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VertexClustering.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+// Planar grid of n x n vertices with unit spacing, vertex (i, j) has index
+// i * n + j, and only the quads with first row in [row_begin, row_end).
+geometry::TriangleMesh CreateGrid(int n, int row_begin, int row_end) {
+    geometry::TriangleMesh mesh;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            mesh.vertices_.push_back(Vector3d(i, j, 0));
+        }
+    }
+    for (int i = row_begin; i < row_end; i++) {
+        for (int j = 0; j + 1 < n; j++) {
+            int v = i * n + j;
+            mesh.triangles_.push_back(Vector3i(v, v + n, v + n + 1));
+            mesh.triangles_.push_back(Vector3i(v, v + n + 1, v + 1));
+        }
+    }
+    return mesh;
+}
+
+}  // unnamed namespace
+
+TEST(VertexClustering, AddMesh) {
+    geometry::TriangleMesh grid = CreateGrid(4, 0, 3);
+    grid.ComputeVertexNormals();
+    geometry::VertexClustering clustering(2.0,
+                                          geometry::MeshBase::
+                                                  SimplificationContraction::
+                                                          Average,
+                                          Vector3d(-0.5, -0.5, -0.5));
+    clustering.AddMesh(grid);
+    EXPECT_EQ(4u, clustering.NumClusters());
+
+    // Clusters are numbered by their first vertex.
+    auto mesh = clustering.ExtractTriangleMesh();
+    ExpectEQ(vector<Vector3d>({{0.5, 0.5, 0},
+                               {0.5, 2.5, 0},
+                               {2.5, 0.5, 0},
+                               {2.5, 2.5, 0}}),
+             mesh->vertices_);
+    ExpectEQ(vector<Vector3d>(4, Vector3d(0, 0, 1)), mesh->vertex_normals_);
+    EXPECT_FALSE(mesh->HasVertexColors());
+    ExpectEQ(vector<Vector3i>({{0, 2, 3}, {0, 3, 1}}), mesh->triangles_);
+
+    // Adding the same mesh again neither adds clusters nor triangles.
+    clustering.AddMesh(grid);
+    EXPECT_EQ(4u, clustering.NumClusters());
+    auto twice = clustering.ExtractTriangleMesh();
+    ExpectEQ(mesh->vertices_, twice->vertices_);
+    ExpectEQ(mesh->triangles_, twice->triangles_);
+
+    clustering.Reset();
+    EXPECT_EQ(0u, clustering.NumClusters());
+    EXPECT_TRUE(clustering.ExtractTriangleMesh()->IsEmpty());
+
+    grid.vertices_[5] = Vector3d(1e7, 0, 0);
+    EXPECT_ANY_THROW(clustering.AddMesh(grid));
+}
+
+TEST(VertexClustering, Chunks) {
+    // The second chunk shares the vertices of row 5 with the first one.
+    geometry::TriangleMesh first = CreateGrid(12, 0, 5);
+    geometry::TriangleMesh second = CreateGrid(12, 5, 11);
+    first.RemoveUnreferencedVertices();
+    second.RemoveUnreferencedVertices();
+    auto whole = CreateGrid(12, 0, 11);
+
+    Vector3d origin(-0.25, -0.25, -0.25);
+    geometry::VertexClustering clustering(
+            3.0, geometry::MeshBase::SimplificationContraction::Average,
+            origin);
+    clustering.AddMesh(first);
+    clustering.AddMesh(second);
+    auto chunked = clustering.ExtractTriangleMesh();
+
+    clustering.Reset();
+    clustering.AddMesh(whole);
+    auto reference = clustering.ExtractTriangleMesh();
+
+    EXPECT_EQ(16u, reference->vertices_.size());
+    ASSERT_EQ(reference->vertices_.size(), chunked->vertices_.size());
+    for (size_t vidx = 0; vidx < reference->vertices_.size(); vidx++) {
+        // The shared vertices are counted twice in the average.
+        EXPECT_LT((reference->vertices_[vidx] - chunked->vertices_[vidx])
+                          .norm(),
+                  0.5);
+    }
+    ExpectEQ(reference->triangles_, chunked->triangles_);
+}
+
+TEST(VertexClustering, Quadric) {
+    auto box = geometry::TriangleMesh::CreateBox(10.0, 10.0, 10.0)
+                       ->SubdivideMidpoint(3);
+    auto average = box->SimplifyVertexClustering(
+            3.0, geometry::MeshBase::SimplificationContraction::Average);
+    auto quadric = box->SimplifyVertexClustering(
+            3.0, geometry::MeshBase::SimplificationContraction::Quadric);
+    ASSERT_EQ(average->vertices_.size(), quadric->vertices_.size());
+    ExpectEQ(average->triangles_, quadric->triangles_);
+
+    // The quadrics keep the corners of the box, averaging cuts them.
+    auto ClosestDistance = [](const geometry::TriangleMesh &mesh,
+                              const Vector3d &point) {
+        double distance = numeric_limits<double>::infinity();
+        for (const Vector3d &vertex : mesh.vertices_) {
+            distance = min(distance, (vertex - point).norm());
+        }
+        return distance;
+    };
+    for (const Vector3d &corner : {Vector3d(0, 0, 0), Vector3d(10, 0, 0),
+                                   Vector3d(0, 10, 10), Vector3d(10, 10, 10)}) {
+        EXPECT_LT(ClosestDistance(*quadric, corner), 1e-6);
+        EXPECT_GT(ClosestDistance(*average, corner), 0.1);
+    }
+}
@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/TriangleMeshLODIO.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshLOD.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(TriangleMeshLODIO, WriteReadTriangleMeshLOD) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    auto lod_gt = geometry::TriangleMeshLOD::CreateFromTriangleMesh(
+            *sphere, 2, 0.5, 1);
+
+    EXPECT_TRUE(io::WriteTriangleMeshLOD("tmp.lod", *lod_gt));
+
+    geometry::TriangleMeshLOD lod_test;
+    EXPECT_TRUE(io::ReadTriangleMeshLOD("tmp.lod", lod_test));
+    ASSERT_EQ(lod_gt->NumLevels(), lod_test.NumLevels());
+    ASSERT_EQ(lod_gt->NumTiles(), lod_test.NumTiles());
+    ExpectEQ(lod_gt->origin_, lod_test.origin_);
+    EXPECT_EQ(lod_gt->tile_size_, lod_test.tile_size_);
+    EXPECT_EQ(lod_gt->tile_depth_, lod_test.tile_depth_);
+    ExpectEQ(lod_gt->tile_indices_, lod_test.tile_indices_);
+    for (size_t level = 0; level < lod_gt->NumLevels(); level++) {
+        for (size_t tile = 0; tile < lod_gt->NumTiles(); tile++) {
+            // Positions and normals are stored as floats, colors as bytes.
+            const auto &mesh_gt = *lod_gt->levels_[level][tile];
+            const auto &mesh_test = *lod_test.levels_[level][tile];
+            ExpectEQ(mesh_gt.vertices_, mesh_test.vertices_, 1e-6);
+            ExpectEQ(mesh_gt.vertex_normals_, mesh_test.vertex_normals_,
+                     1e-6);
+            ExpectEQ(mesh_gt.vertex_colors_, mesh_test.vertex_colors_,
+                     1e-2);
+            ExpectEQ(mesh_gt.triangles_, mesh_test.triangles_);
+        }
+    }
+
+    geometry::TriangleMesh tile;
+    EXPECT_TRUE(io::ReadTriangleMeshLODTile("tmp.lod", 1, 3, tile));
+    ExpectEQ(lod_test.levels_[1][3]->vertices_, tile.vertices_);
+    ExpectEQ(lod_test.levels_[1][3]->triangles_, tile.triangles_);
+    EXPECT_FALSE(io::ReadTriangleMeshLODTile("tmp.lod", 2, 0, tile));
+}
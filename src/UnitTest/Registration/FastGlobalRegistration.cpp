@@ -24,8 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(FastGlobalRegistration, DISABLED_FastGlobalRegistrationOption) {
     unit_test::NotImplemented();
 }
@@ -41,3 +51,37 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) {
 TEST(FastGlobalRegistration, DISABLED_MemberData) {
     unit_test::NotImplemented();
 }
+
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    // Random points with distinctive random features. The target is a rigidly
+    // moved copy of the source carrying the same features.
+    const int size = 500;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    geometry::PointCloud source;
+    registration::Feature feature;
+    feature.Resize(8, size);
+    for (int i = 0; i < size; i++) {
+        source.points_.push_back(
+                Eigen::Vector3d(dist(gen), dist(gen), dist(gen)));
+        for (int k = 0; k < 8; k++) {
+            feature.data_(k, i) = dist(gen);
+        }
+    }
+
+    Eigen::Vector6d motion;
+    motion << 0.3, -0.2, 0.1, 0.5, 0.2, -0.4;
+    const Eigen::Matrix4d gt = utility::TransformVector6dToMatrix4d(motion);
+    geometry::PointCloud target = source;
+    target.Transform(gt);
+
+    for (bool approximate : {false, true}) {
+        registration::FastGlobalRegistrationOption option;
+        option.use_approximate_matching_ = approximate;
+        auto result = registration::FastGlobalRegistration(
+                source, target, feature, feature, option);
+
+        EXPECT_NEAR(1.0, result.fitness_, 1e-3);
+        ExpectEQ(gt, Eigen::Matrix4d(result.transformation_), 1e-3);
+    }
+}
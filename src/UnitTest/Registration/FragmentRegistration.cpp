@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/FragmentRegistration.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FragmentRegistration, RegisterFragmentsOdometry) {
+    // Fragment i sees the same scene moved by motions[i]. Odometry pairs are
+    // initialized with a perturbed ground truth and must be refined to it.
+    auto mesh = geometry::TriangleMesh::CreateBox(1.0, 0.6, 0.3);
+    auto scene = mesh->SamplePointsUniformly(20000);
+
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> motions;
+    motions.push_back(Eigen::Matrix4d::Identity());
+    Eigen::Vector6d motion;
+    motion << 0.05, -0.02, 0.03, 0.04, 0.02, -0.03;
+    motions.push_back(utility::TransformVector6dToMatrix4d(motion));
+    motion << -0.03, 0.04, 0.02, -0.02, 0.05, 0.01;
+    motions.push_back(utility::TransformVector6dToMatrix4d(motion) *
+                      motions.back());
+
+    std::vector<std::shared_ptr<geometry::PointCloud>> fragments;
+    for (const auto &m : motions) {
+        auto fragment = std::make_shared<geometry::PointCloud>(*scene);
+        fragment->Transform(m);
+        fragments.push_back(fragment);
+    }
+
+    Eigen::Vector6d perturbation;
+    perturbation << 0.01, -0.01, 0.01, 0.01, 0.005, -0.01;
+    const Eigen::Matrix4d noise =
+            utility::TransformVector6dToMatrix4d(perturbation);
+    std::vector<registration::FragmentPair> pairs;
+    for (int i = 0; i + 1 < (int)fragments.size(); i++) {
+        pairs.push_back(registration::FragmentPair(
+                i, i + 1, noise * motions[i + 1] * motions[i].inverse()));
+    }
+
+    registration::FragmentRegistrationOption option(0.02);
+    auto pose_graph = registration::RegisterFragments(fragments, pairs, option);
+
+    ASSERT_EQ(pose_graph->nodes_.size(), fragments.size());
+    ASSERT_EQ(pose_graph->edges_.size(), pairs.size());
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const auto &edge = pose_graph->edges_[i];
+        EXPECT_EQ(edge.source_node_id_, pairs[i].source_id_);
+        EXPECT_EQ(edge.target_node_id_, pairs[i].target_id_);
+        EXPECT_FALSE(edge.uncertain_);
+        EXPECT_GT(edge.information_(5, 5), 0.0);
+        ExpectEQ(Eigen::Matrix4d(edge.transformation_),
+                 Eigen::Matrix4d(motions[i + 1] * motions[i].inverse()), 1e-3);
+    }
+    for (size_t i = 0; i < fragments.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph->nodes_[i].pose_),
+                 Eigen::Matrix4d(motions[i].inverse()), 1e-3);
+    }
+}
+
+TEST(FragmentRegistration, RegisterFragmentsInvalidPair) {
+    std::vector<std::shared_ptr<geometry::PointCloud>> fragments(
+            2, std::make_shared<geometry::PointCloud>());
+    std::vector<registration::FragmentPair> pairs = {
+            registration::FragmentPair(0, 2)};
+    EXPECT_ANY_THROW(registration::RegisterFragments(fragments, pairs));
+}
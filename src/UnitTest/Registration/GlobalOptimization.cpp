@@ -24,8 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
@@ -45,3 +54,73 @@ TEST(GlobalOptimization, DISABLED_GlobalOptimizationOption) {
 TEST(GlobalOptimization, DISABLED_CreatePoseGraphWithoutInvalidEdges) {
     unit_test::NotImplemented();
 }
+
+TEST(GlobalOptimization, IncrementalGlobalOptimization) {
+    // Nodes on a circle, connected by noisy odometry and closed by an exact
+    // loop closure between the last and the first node.
+    const int n_nodes = 20;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    for (int i = 0; i < n_nodes; i++) {
+        double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose;
+        pose << 0.0, 0.0, angle, 2.0 * std::cos(angle), 2.0 * std::sin(angle),
+                0.0;
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose));
+    }
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 1000.0;
+    Eigen::Vector6d noise;
+    noise << 0.01, -0.005, 0.01, 0.02, -0.01, 0.005;
+
+    registration::GlobalOptimizationOption option;
+    option.reference_node_ = 0;
+    registration::IncrementalGlobalOptimization incremental(
+            registration::GlobalOptimizationConvergenceCriteria(), option);
+    registration::PoseGraph pose_graph;
+    incremental.AddNode(registration::PoseGraphNode(poses[0]));
+    pose_graph.nodes_.push_back(registration::PoseGraphNode(poses[0]));
+    for (int i = 1; i < n_nodes; i++) {
+        Eigen::Matrix4d odometry = utility::TransformVector6dToMatrix4d(noise) *
+                                   poses[i].inverse() * poses[i - 1];
+        Eigen::Matrix4d pose = Eigen::Matrix4d(pose_graph.nodes_.back().pose_) *
+                               odometry.inverse();
+        registration::PoseGraphEdge edge(i - 1, i, odometry, information,
+                                         false);
+        EXPECT_EQ(incremental.AddNode(registration::PoseGraphNode(pose)), i);
+        incremental.AddEdge(edge);
+        incremental.Update();
+        EXPECT_EQ(incremental.GetNumberOfAffectedNodes(), i == 1 ? 1 : 2);
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+        pose_graph.edges_.push_back(edge);
+    }
+    // Consistent odometry leaves the chained poses unchanged.
+    for (int i = 0; i < n_nodes; i++) {
+        ExpectEQ(Eigen::Matrix4d(incremental.GetPoseGraph().nodes_[i].pose_),
+                 Eigen::Matrix4d(pose_graph.nodes_[i].pose_), 1e-6);
+    }
+
+    registration::PoseGraphEdge loop_closure(
+            n_nodes - 1, 0, poses[0].inverse() * poses[n_nodes - 1],
+            information, false);
+    incremental.AddEdge(loop_closure);
+    incremental.Update();
+    EXPECT_EQ(incremental.GetNumberOfAffectedNodes(), n_nodes - 1);
+    // The loop closure pulls the drifted last node back.
+    EXPECT_GT((Eigen::Matrix4d(pose_graph.nodes_.back().pose_) -
+               poses.back()).norm(),
+              (Eigen::Matrix4d(incremental.GetPoseGraph().nodes_.back().pose_) -
+               poses.back()).norm());
+    pose_graph.edges_.push_back(loop_closure);
+
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            registration::GlobalOptimizationConvergenceCriteria(), option);
+    for (int i = 0; i < n_nodes; i++) {
+        ExpectEQ(Eigen::Matrix4d(incremental.GetPoseGraph().nodes_[i].pose_),
+                 Eigen::Matrix4d(pose_graph.nodes_[i].pose_), 1e-4);
+    }
+
+    // Nothing was added, nothing to update.
+    incremental.Update();
+    EXPECT_EQ(incremental.GetNumberOfAffectedNodes(), 0);
+    EXPECT_ANY_THROW(incremental.AddEdge(registration::PoseGraphEdge(0, 0)));
+}
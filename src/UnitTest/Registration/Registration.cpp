@@ -24,8 +24,21 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -60,6 +73,57 @@ TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
     unit_test::NotImplemented();
 }
 
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatchingSeed) {
+    // Half of the target features are replaced by random ones, so that many
+    // of the feature matches are outliers.
+    const int size = 300;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    geometry::PointCloud source;
+    registration::Feature source_feature, target_feature;
+    source_feature.Resize(8, size);
+    target_feature.Resize(8, size);
+    for (int i = 0; i < size; i++) {
+        source.points_.push_back(
+                Eigen::Vector3d(dist(gen), dist(gen), dist(gen)));
+        for (int k = 0; k < 8; k++) {
+            source_feature.data_(k, i) = dist(gen);
+            target_feature.data_(k, i) =
+                    i % 2 == 0 ? source_feature.data_(k, i) : dist(gen);
+        }
+    }
+    Eigen::Vector6d motion;
+    motion << 0.3, -0.2, 0.1, 0.5, 0.2, -0.4;
+    const Eigen::Matrix4d gt = utility::TransformVector6dToMatrix4d(motion);
+    geometry::PointCloud target = source;
+    target.Transform(gt);
+
+    registration::RANSACConvergenceCriteria criteria(2000, 100, 7);
+    std::vector<registration::RegistrationResult> results;
+    for (int num_threads : {1, 4}) {
+#ifdef _OPENMP
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(num_threads);
+#else
+        (void)num_threads;
+#endif
+        results.push_back(
+                registration::RegistrationRANSACBasedOnFeatureMatching(
+                        source, target, source_feature, target_feature, 0.01,
+                        registration::TransformationEstimationPointToPoint(
+                                false),
+                        3, {}, criteria));
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+    }
+
+    EXPECT_NEAR(results[0].fitness_, 1.0, 1e-12);
+    ExpectEQ(Eigen::Matrix4d(results[0].transformation_), gt, 1e-6);
+    EXPECT_EQ(results[0].fitness_, results[1].fitness_);
+    EXPECT_TRUE(results[0].transformation_ == results[1].transformation_);
+}
+
 TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
     unit_test::NotImplemented();
 }
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(RobustKernel, L2Loss) {
+    registration::L2Loss kernel;
+
+    EXPECT_EQ(registration::RobustKernelType::L2, kernel.GetKernelType());
+    EXPECT_NEAR(1.0, kernel.Weight(0.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(1.0, kernel.Weight(-1e3), THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, HuberLoss) {
+    registration::HuberLoss kernel(0.5);
+
+    EXPECT_EQ(registration::RobustKernelType::Huber, kernel.GetKernelType());
+    EXPECT_NEAR(1.0, kernel.Weight(0.2), THRESHOLD_1E_6);
+    EXPECT_NEAR(1.0, kernel.Weight(-0.5), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.25, kernel.Weight(2.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.25, kernel.Weight(-2.0), THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, TukeyLoss) {
+    registration::TukeyLoss kernel(2.0);
+
+    EXPECT_EQ(registration::RobustKernelType::Tukey, kernel.GetKernelType());
+    EXPECT_NEAR(1.0, kernel.Weight(0.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.5625, kernel.Weight(-1.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.0, kernel.Weight(2.5), THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, CauchyLoss) {
+    registration::CauchyLoss kernel(2.0);
+
+    EXPECT_EQ(registration::RobustKernelType::Cauchy, kernel.GetKernelType());
+    EXPECT_NEAR(1.0, kernel.Weight(0.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.5, kernel.Weight(2.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.2, kernel.Weight(-4.0), THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, GMLoss) {
+    registration::GMLoss kernel(2.0);
+
+    EXPECT_EQ(registration::RobustKernelType::GemanMcClure,
+              kernel.GetKernelType());
+    EXPECT_NEAR(1.0, kernel.Weight(0.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.25, kernel.Weight(2.0), THRESHOLD_1E_6);
+    EXPECT_NEAR(0.04, kernel.Weight(-4.0), THRESHOLD_1E_6);
+}
+
+TEST(RobustKernel, IRLSOption) {
+    registration::IRLSOption option;
+
+    EXPECT_EQ(1, option.max_iteration_);
+    EXPECT_NEAR(1.0, option.gnc_initial_scale_, THRESHOLD_1E_6);
+    EXPECT_NEAR(1.4, option.gnc_division_factor_, THRESHOLD_1E_6);
+    EXPECT_NEAR(1e-6, option.min_update_, THRESHOLD_1E_6);
+}
@@ -24,8 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(TransformationEstimation, DISABLED_Constructor) {
     unit_test::NotImplemented();
 }
@@ -57,3 +63,52 @@ TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPoint) {
 TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPlane) {
     unit_test::NotImplemented();
 }
+
+TEST(TransformationEstimation, PointToPlaneRobustKernel) {
+    // Points on the faces of a box seen from all sides, so that all six
+    // degrees of freedom are constrained by the point to plane distance.
+    geometry::PointCloud target;
+    for (int axis = 0; axis < 3; axis++) {
+        for (double side : {-1.0, 1.0}) {
+            for (int u = 0; u < 10; u++) {
+                for (int v = 0; v < 10; v++) {
+                    Eigen::Vector3d p, n = Eigen::Vector3d::Zero();
+                    p(axis) = side;
+                    p((axis + 1) % 3) = -0.9 + 0.2 * u;
+                    p((axis + 2) % 3) = -0.9 + 0.2 * v;
+                    n(axis) = side;
+                    target.points_.push_back(p);
+                    target.normals_.push_back(n);
+                }
+            }
+        }
+    }
+
+    Eigen::Vector6d motion;
+    motion << 0.02, -0.01, 0.015, 0.03, -0.02, 0.01;
+    const Eigen::Matrix4d gt = utility::TransformVector6dToMatrix4d(motion);
+
+    geometry::PointCloud source = target;
+    source.Transform(gt.inverse());
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < (int)target.points_.size(); i++) {
+        corres.push_back(Eigen::Vector2i(i, i));
+    }
+    // Corrupt every tenth correspondence with a gross outlier.
+    for (size_t i = 0; i < source.points_.size(); i += 10) {
+        source.points_[i] += 0.5 * target.normals_[i];
+    }
+
+    registration::TransformationEstimationPointToPlane least_squares;
+    registration::TransformationEstimationPointToPlane robust(
+            std::make_shared<registration::TukeyLoss>(0.05),
+            registration::IRLSOption(30, 20.0, 1.4));
+
+    const Eigen::Matrix4d t_l2 =
+            least_squares.ComputeTransformation(source, target, corres);
+    const Eigen::Matrix4d t_robust =
+            robust.ComputeTransformation(source, target, corres);
+
+    EXPECT_GT((t_l2 - gt).norm(), 1e-3);
+    ExpectEQ(gt, t_robust, 1e-4);
+}
@@ -257,3 +257,25 @@ TEST(Eigen, ComputeJTJandJTr_vector) {
     ExpectEQ(ref_JTr, JTr);
     ExpectEQ(ref_JTJ, JTJ);
 }
+
+TEST(Eigen, ComputeMeanAndCovariance) {
+    // Spans several reduction chunks.
+    vector<Vector3d> points(10000);
+    Rand(points, Vector3d(-10.0, -10.0, -10.0), Vector3d(1000.0, 10.0, 1.0), 0);
+
+    Vector3d ref_mean = Vector3d::Zero();
+    for (const auto& p : points) ref_mean += p;
+    ref_mean /= (double)points.size();
+    Matrix3d ref_covariance = Matrix3d::Zero();
+    for (const auto& p : points) {
+        ref_covariance += (p - ref_mean) * (p - ref_mean).transpose();
+    }
+    ref_covariance /= (double)points.size();
+
+    Vector3d mean;
+    Matrix3d covariance;
+    tie(mean, covariance) = utility::ComputeMeanAndCovariance(points);
+
+    ExpectEQ(ref_mean, mean);
+    ExpectEQ(ref_covariance, covariance);
+}
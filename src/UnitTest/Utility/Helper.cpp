@@ -24,6 +24,62 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+
+#include "Open3D/Utility/Helper.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Helper, DISABLED_SplitString) { unit_test::NotImplemented(); }
+
+TEST(Helper, RandomStream) {
+    utility::RandomStream rng0(42, 3);
+    utility::RandomStream rng1(42, 3);
+    utility::RandomStream rng2(42, 4);
+    int num_different = 0;
+    for (int i = 0; i < 1000; i++) {
+        int value = rng0.UniformInt(-5, 5);
+        EXPECT_EQ(value, rng1.UniformInt(-5, 5));
+        EXPECT_GE(value, -5);
+        EXPECT_LE(value, 5);
+        if (value != rng2.UniformInt(-5, 5)) num_different++;
+    }
+    EXPECT_GT(num_different, 500);
+
+    // Full int range.
+    const int min = std::numeric_limits<int>::min();
+    const int max = std::numeric_limits<int>::max();
+    utility::RandomStream rng3(0, 0);
+    utility::RandomStream rng4(0, 0);
+    int num_negative = 0;
+    int num_positive = 0;
+    for (int i = 0; i < 100; i++) {
+        int value = rng3.UniformInt(min, max);
+        EXPECT_EQ(value, rng4.UniformInt(min, max));
+        if (value < 0) num_negative++;
+        if (value > 0) num_positive++;
+    }
+    EXPECT_GT(num_negative, 0);
+    EXPECT_GT(num_positive, 0);
+
+    double sum = 0;
+    for (int i = 0; i < 1000; i++) {
+        double value = rng3.UniformDouble();
+        EXPECT_GE(value, 0.0);
+        EXPECT_LT(value, 1.0);
+        sum += value;
+    }
+    EXPECT_NEAR(0.5, sum / 1000, 0.05);
+}
+
+TEST(Helper, NonZeroIndices) {
+    std::vector<char> mask(200000, 0);
+    std::vector<size_t> ref;
+    for (size_t i = 0; i < mask.size(); i += 7) {
+        mask[i] = 1;
+        ref.push_back(i);
+    }
+    EXPECT_EQ(ref, utility::NonZeroIndices(mask));
+    EXPECT_TRUE(utility::NonZeroIndices(std::vector<char>()).empty());
+}